@@ -0,0 +1,46 @@
+/**
+ * @file Cache.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Binary (CSC) sparse matrix cache, general or symmetric (lower) storage.
+ * @date 2024-12-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef NASS_CACHE_HPP
+#define NASS_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include "./Core.hpp"
+
+namespace nass {
+    namespace internal {
+
+        // Checksum.
+
+        [[nodiscard]] std::uint64_t Ck_CvN_N(const unsigned char*, const natural_t&);
+
+        // Store, instantiated for natural_t and natural32_t indices.
+
+        template<typename index_t> [[nodiscard]] bool Stb_StNNvNvRvB_B(const std::string&, const natural_t&, const index_t*, const index_t*, const real_t*, const bool&);
+
+        // Numeric refresh.
+
+        [[nodiscard]] bool Rfb_StNRv_B(const std::string&, const natural_t&, const real_t*);
+
+        // Load.
+
+        template<typename index_t> [[nodiscard]] std::tuple<natural_t, const index_t*, const index_t*, const real_t*, bool> Ldb_St_NNvNvRvB(const std::string&);
+
+        // Close.
+
+        template<typename index_t> void Clb_Nv_0(const index_t*);
+
+    }
+}
+
+#endif
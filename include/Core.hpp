@@ -12,6 +12,7 @@
 #define NASS_CORE_HPP
 
 #include <cstddef>
+#include <cstdint>
 
 // OpenMP support.
 
@@ -19,7 +20,7 @@
 #include <omp.h>
 #endif
 
-// Neon support and floating-point types.
+// Neon, AVX support and floating-point types.
 
 #if defined(__ARM_NEON) && !defined(NNEON)
 #ifndef _NEON
@@ -27,6 +28,12 @@
 #endif
 #endif
 
+#if defined(__AVX2__) && defined(__FMA__) && !defined(_NEON) // Target flags, per translation unit.
+#ifndef _AVX
+#define _AVX // Custom AVX flag.
+#endif
+#endif
+
 #if defined(LOOP_OFFSET) || defined(MEMORY_OFFSET) || defined(MEMORY_OFFSET_0) || defined(MEMORY_OFFSET_1)
 #error "Unsafe constant definition."
 #endif
@@ -74,12 +81,50 @@ namespace nass {
 
 #endif
 
-// Multiple offsets for loop-unrolling.
+#elif defined(_AVX)
+#include <immintrin.h>
 
-#define MEMORY_OFFSET_0 MEMORY_OFFSET * 0 // Superfluous.
-#define MEMORY_OFFSET_1 MEMORY_OFFSET * 1 // Superfluous.
+#ifdef __AVX512F__ // 512-bit registers.
+
+#ifndef AVX512
+#define AVX512
+#endif
+
+#define LOOP_OFFSET 16
+#define MEMORY_OFFSET 8
+
+namespace nass {
+    using real_t = double;
+    
+    namespace internal {
+        using reals_t = __m512d;
+
+        constexpr real_t real_tol = 1.0E-14;
+    }
+}
+
+#else // 256-bit registers.
+
+#ifndef AVX2
+#define AVX2
+#endif
+
+#define LOOP_OFFSET 8
+#define MEMORY_OFFSET 4
 
-#else // Missing Neon support.
+namespace nass {
+    using real_t = double;
+    
+    namespace internal {
+        using reals_t = __m256d;
+
+        constexpr real_t real_tol = 1.0E-14;
+    }
+}
+
+#endif
+
+#else // Missing Neon and AVX support.
 
 namespace nass {
     using real_t = double;
@@ -91,11 +136,30 @@ namespace nass {
 
 #endif
 
+#if defined(_NEON) || defined(_AVX)
+#ifndef _SIMD
+#define _SIMD // Custom reals_t flag.
+#endif
+
+// Multiple offsets for loop-unrolling.
+
+#define MEMORY_OFFSET_0 MEMORY_OFFSET * 0 // Superfluous.
+#define MEMORY_OFFSET_1 MEMORY_OFFSET * 1 // Superfluous.
+#endif
+
 // Integral types.
 
 namespace nass {
     using natural_t = std::size_t;
     using integer_t = std::ptrdiff_t;
+
+    using natural32_t = std::uint32_t; // Compact sparse indices.
+}
+
+// Compact floating-point type.
+
+namespace nass {
+    using value32_t = float; // Compact sparse values.
 }
 
 // Checks.
@@ -109,8 +173,12 @@ namespace nass {
 
 #ifdef _NEON
 #pragma message "Neon enabled."
+#elif defined(_AVX) && defined(AVX512)
+#pragma message "AVX-512 enabled."
+#elif defined(_AVX)
+#pragma message "AVX2 enabled."
 #else
-#pragma message "Neon NOT supported/enabled."
+#pragma message "Neon, AVX NOT supported/enabled."
 #endif
 #endif
 
@@ -16,20 +16,22 @@
 namespace nass {
     namespace internal {
 
+        // Instantiated for double and float.
+
         // Pivoting.
 
-        void Pv_RmtNvtNNN_0(real_t*, natural_t*, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Pv_RmtNvtNNN_0(scalar_t*, natural_t*, const natural_t&, const natural_t&, const natural_t&);
 
         // Products.
 
-        void Lh_RmtRvNNN_0(real_t*, const real_t*, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Lh_RmtRvNNN_0(scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&);
 
-        void Mq_RvtRmNN_0(real_t*, const real_t*, const natural_t&, const natural_t&, const natural_t&);
-        void Mqt_RvtRmNN_0(real_t*, const real_t*, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Mq_RvtRmNN_0(scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Mqt_RvtRmNN_0(scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&);
 
         // (Thin) QR.
 
-        void TQR_RmtRmtNvtNN_0(real_t*, real_t*, natural_t*, const natural_t&, const natural_t&);
+        template<typename scalar_t> void TQR_RmtRmtNvtNN_0(scalar_t*, scalar_t*, natural_t*, const natural_t&, const natural_t&);
 
     }
 }
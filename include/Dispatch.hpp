@@ -0,0 +1,92 @@
+/**
+ * @file Dispatch.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Runtime instruction set dispatch of the vector kernels.
+ * @date 2024-12-21
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef NASS_DISPATCH_HPP
+#define NASS_DISPATCH_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "./Core.hpp"
+
+namespace nass {
+    namespace internal {
+
+        // Instruction set levels.
+
+        enum class isa_t : std::uint32_t {
+            scalar, // Compiler's baseline.
+            neon, // Neon, AArch64 baseline.
+            avx2, // AVX2 and FMA, 256-bit.
+            avx512 // AVX-512F, AVX2 and FMA, 512-bit.
+        };
+
+        [[nodiscard]] std::string_view Nm_I_St(const isa_t&);
+
+        // Vector kernels, one table per level and precision, see include/Vectors.hpp.
+
+        template<typename scalar_t>
+        struct vectors_t {
+            isa_t I0; // Level.
+
+            void (*Cp_RvtRvN_0)(scalar_t*, const scalar_t*, const natural_t&);
+
+            scalar_t (*Dt_RvRvN_R)(const scalar_t*, const scalar_t*, const natural_t&);
+            scalar_t (*NPDt_RvRvN_R)(const scalar_t*, const scalar_t*, const natural_t&);
+
+            scalar_t (*Nr_RvN_R)(const scalar_t*, const natural_t&);
+            void (*Nrz_RvtN_0)(scalar_t*, const natural_t&);
+
+            scalar_t (*NPNr_RvN_R)(const scalar_t*, const natural_t&);
+            void (*NPNrz_RvtN_0)(scalar_t*, const natural_t&);
+
+            scalar_t (*Prj_RvtRvRvN_R)(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&);
+
+            void (*Dtb_RvtRmRvNNNN_0)(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+            void (*Prb_RvtRmRvNNNN_0)(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+
+            void (*Dtl_RvtRmRvRvNNNN_0)(scalar_t*, const scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+            void (*Prl_RvtRvtRmRvNNNNRR_0)(scalar_t*, scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&, const scalar_t&, const scalar_t&);
+
+            // Sequential inner kernels of the sparse products, see include/Sparse.hpp.
+
+            void (*Axm_RvtRRvN_0)(scalar_t*, const scalar_t&, const scalar_t*, const natural_t&);
+            void (*Fma_RvtRvRvN_0)(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&);
+            void (*Dtc_RvtRvRvNN_0)(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&);
+        };
+
+        // Tables, one translation unit (src/NASS_Kernels.cpp) compiled once per level, double [64] and float [32] precision.
+
+        #if defined(__x86_64__)
+        extern const vectors_t<double> vectors_scalar_64, vectors_avx2_64, vectors_avx512_64;
+        extern const vectors_t<float> vectors_scalar_32, vectors_avx2_32, vectors_avx512_32;
+        #elif defined(__aarch64__) && !defined(NNEON)
+        extern const vectors_t<double> vectors_neon_64;
+        extern const vectors_t<float> vectors_neon_32;
+        #else
+        extern const vectors_t<double> vectors_scalar_64;
+        extern const vectors_t<float> vectors_scalar_32;
+        #endif
+
+        // Levels.
+
+        [[nodiscard]] const std::vector<isa_t>& Lvs_0_Iv();
+        [[nodiscard]] isa_t Isa_0_I();
+
+        // Binding, instantiated for double and float.
+
+        template<typename scalar_t> [[nodiscard]] const vectors_t<scalar_t>& Vct_I_Vt(const isa_t&);
+        template<typename scalar_t> [[nodiscard]] const vectors_t<scalar_t>& Vct_0_Vt();
+
+    }
+}
+
+#endif
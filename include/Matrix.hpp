@@ -16,20 +16,22 @@
 namespace nass {
     namespace internal {
 
+        // Instantiated for double and float.
+
         // Products.
         
-        void Ml_RvtRmRvNN_0(real_t*, const real_t*, const real_t*, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Ml_RvtRmRvNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&);
 
-        void Ml_RmtTRmRmNNN_0(real_t*, const real_t*, const real_t*, const natural_t&, const natural_t&, const natural_t&);
-        void Ml_RmtRmRmNNN_0(real_t*, const real_t*, const real_t*, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Ml_RmtTRmRmNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Ml_RmtRmRmNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&);
 
         // Embeddings.
 
-        [[nodiscard]] real_t* Gs_NN_Rm(const natural_t&, const natural_t&);
+        template<typename scalar_t> [[nodiscard]] scalar_t* Gs_NNN_Rm(const natural_t&, const natural_t&, const natural_t&);
 
         // Output.
 
-        void Pr_RmNN_0(const real_t*, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Pr_RmNN_0(const scalar_t*, const natural_t&, const natural_t&);
 
     }
 }
@@ -0,0 +1,44 @@
+/**
+ * @file Numa.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief NUMA placement: first touch, thread pinning and placement report.
+ * @date 2024-12-19
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef NASS_NUMA_HPP
+#define NASS_NUMA_HPP
+
+#include <tuple>
+#include <vector>
+
+#include "./Core.hpp"
+
+namespace nass {
+    namespace internal {
+
+        // Topology.
+
+        [[nodiscard]] natural_t Nds_0_N();
+
+        // Thread pinning.
+
+        [[nodiscard]] bool Pin_0_B();
+
+        // First touch, instantiated for double and float values and for natural_t and natural32_t indices.
+
+        template<typename value_t> [[nodiscard]] value_t* Ftz_NN_Rm(const natural_t&, const natural_t&);
+        template<typename index_t> [[nodiscard]] std::tuple<index_t*, index_t*, real_t*> Ftc_NNvNvRvN_NvNvRv(const natural_t&, const index_t*, const index_t*, const real_t*, const natural_t&);
+
+        // Placement report.
+
+        [[nodiscard]] std::vector<natural_t> Thr_0_Nv();
+        [[nodiscard]] std::vector<natural_t> Plc_CvN_Nv(const void*, const natural_t&);
+        [[nodiscard]] bool Lcl_CvN_B(const void*, const natural_t&);
+
+    }
+}
+
+#endif
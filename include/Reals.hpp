@@ -15,7 +15,7 @@
 
 #include "./Core.hpp"
 
-#ifdef _NEON
+#ifdef _SIMD
 
 namespace nass {
     namespace internal {
@@ -31,8 +31,12 @@ namespace nass {
         static inline reals_t Ld_Rv_Rs(const real_t* Rv0) {
             #ifdef NEON32
             return vld1q_f32(Rv0);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vld1q_f64(Rv0);
+            #elif defined(AVX512)
+            return _mm512_loadu_pd(Rv0);
+            #else // AVX2.
+            return _mm256_loadu_pd(Rv0);
             #endif
         }
 
@@ -47,8 +51,12 @@ namespace nass {
         static inline void St_RvtRs_0(real_t* Rvt0, const reals_t& Rs0) {
             #ifdef NEON32
             vst1q_f32(Rvt0, Rs0);
-            #else // NEON64.
+            #elif defined(NEON64)
             vst1q_f64(Rvt0, Rs0);
+            #elif defined(AVX512)
+            _mm512_storeu_pd(Rvt0, Rs0);
+            #else // AVX2.
+            _mm256_storeu_pd(Rvt0, Rs0);
             #endif
         }
 
@@ -63,8 +71,12 @@ namespace nass {
         static inline reals_t Ex_R_Rs(const real_t& R0) {
             #ifdef NEON32
             return vdupq_n_f32(R0);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vdupq_n_f64(R0);
+            #elif defined(AVX512)
+            return _mm512_set1_pd(R0);
+            #else // AVX2.
+            return _mm256_set1_pd(R0);
             #endif
         }
 
@@ -79,8 +91,20 @@ namespace nass {
         static inline real_t Rd_Rs_R(const reals_t& Rs0) {
             #ifdef NEON32
             return vaddvq_f32(Rs0);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vaddvq_f64(Rs0);
+            #else // AVX512, AVX2.
+
+            #ifdef AVX512
+            // Full masks, unmasked extractions read undefined registers (-Wuninitialized).
+            const __m256d Rs1 = _mm256_add_pd(_mm512_maskz_extractf64x4_pd(0xF, Rs0, 0), _mm512_maskz_extractf64x4_pd(0xF, Rs0, 1));
+            #else
+            const __m256d Rs1 = Rs0;
+            #endif
+
+            const __m128d Rs2 = _mm_add_pd(_mm256_castpd256_pd128(Rs1), _mm256_extractf128_pd(Rs1, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(Rs2, _mm_unpackhi_pd(Rs2, Rs2)));
+            
             #endif
         }
 
@@ -98,8 +122,12 @@ namespace nass {
         static inline reals_t Ad_RsRs_Rs(const reals_t& Rs0, const reals_t& Rs1) {
             #ifdef NEON32
             return vaddq_f32(Rs0, Rs1);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vaddq_f64(Rs0, Rs1);
+            #elif defined(AVX512)
+            return _mm512_add_pd(Rs0, Rs1);
+            #else // AVX2.
+            return _mm256_add_pd(Rs0, Rs1);
             #endif
         }
 
@@ -115,8 +143,12 @@ namespace nass {
         static inline reals_t Sb_RsRs_Rs(const reals_t& Rs0, const reals_t& Rs1) {
             #ifdef NEON32
             return vsubq_f32(Rs0, Rs1);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vsubq_f64(Rs0, Rs1);
+            #elif defined(AVX512)
+            return _mm512_sub_pd(Rs0, Rs1);
+            #else // AVX2.
+            return _mm256_sub_pd(Rs0, Rs1);
             #endif
         }
 
@@ -132,8 +164,12 @@ namespace nass {
         static inline reals_t Ml_RsRs_Rs(const reals_t& Rs0, const reals_t& Rs1) {
             #ifdef NEON32
             return vmulq_f32(Rs0, Rs1);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vmulq_f64(Rs0, Rs1);
+            #elif defined(AVX512)
+            return _mm512_mul_pd(Rs0, Rs1);
+            #else // AVX2.
+            return _mm256_mul_pd(Rs0, Rs1);
             #endif
         }
 
@@ -149,8 +185,56 @@ namespace nass {
         static inline reals_t Dv_RsRs_Rs(const reals_t& Rs0, const reals_t& Rs1) {
             #ifdef NEON32
             return vdivq_f32(Rs0, Rs1);
-            #else // NEON64.
+            #elif defined(NEON64)
             return vdivq_f64(Rs0, Rs1);
+            #elif defined(AVX512)
+            return _mm512_div_pd(Rs0, Rs1);
+            #else // AVX2.
+            return _mm256_div_pd(Rs0, Rs1);
+            #endif
+        }
+
+        // Fused multiply-add.
+
+        /**
+         * @brief Adds the product of two reals_t to a reals_t, Rs0 + Rs1 * Rs2.
+         * 
+         * @param Rs0 Vectorized real number [Rs].
+         * @param Rs1 Vectorized real number [Rs].
+         * @param Rs2 Vectorized real number [Rs].
+         * @return reals_t Vectorized real number [Rs].
+         */
+        static inline reals_t Fma_RsRsRs_Rs(const reals_t& Rs0, const reals_t& Rs1, const reals_t& Rs2) {
+            #ifdef NEON32
+            return vfmaq_f32(Rs0, Rs1, Rs2);
+            #elif defined(NEON64)
+            return vfmaq_f64(Rs0, Rs1, Rs2);
+            #elif defined(AVX512)
+            return _mm512_fmadd_pd(Rs1, Rs2, Rs0);
+            #else // AVX2.
+            return _mm256_fmadd_pd(Rs1, Rs2, Rs0);
+            #endif
+        }
+
+        // Fused multiply-subtract.
+
+        /**
+         * @brief Subtracts the product of two reals_t from a reals_t, Rs0 - Rs1 * Rs2.
+         * 
+         * @param Rs0 Vectorized real number [Rs].
+         * @param Rs1 Vectorized real number [Rs].
+         * @param Rs2 Vectorized real number [Rs].
+         * @return reals_t Vectorized real number [Rs].
+         */
+        static inline reals_t Fms_RsRsRs_Rs(const reals_t& Rs0, const reals_t& Rs1, const reals_t& Rs2) {
+            #ifdef NEON32
+            return vfmsq_f32(Rs0, Rs1, Rs2);
+            #elif defined(NEON64)
+            return vfmsq_f64(Rs0, Rs1, Rs2);
+            #elif defined(AVX512)
+            return _mm512_fnmadd_pd(Rs1, Rs2, Rs0);
+            #else // AVX2.
+            return _mm256_fnmadd_pd(Rs1, Rs2, Rs0);
             #endif
         }
 
@@ -11,14 +11,38 @@
 #ifndef NASS_SOLVER_HPP
 #define NASS_SOLVER_HPP
 
+#include <array>
+#include <functional>
+
 #include "./Core.hpp"
 
 namespace nass {
     namespace internal {
 
-        // sGMRES.
+        // Operators, on scalar_t vectors.
+
+        template<typename scalar_t> using operator_t = std::function<void(scalar_t*, const scalar_t*)>; // Accumulates A * Rv0 into Rvt0.
+        template<typename scalar_t> using fused_t = std::function<void(scalar_t*, scalar_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, const scalar_t*)>; // Accumulates A * Rv0 into Rvt0 and S * (A * Rv0) into Rvt1, S being the given (CSC) sketch.
+        template<typename scalar_t> using powers_t = std::function<scalar_t(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&)>; // Writes p_(j + 1) = (A - Rv1[j] * I) * p_j / R, p_0 = Rv0, into the j-th column of Rmt0, for j < N, N being at most powers_steps, and returns the scaling R.
+
+        // Orthogonalization of a basis column, reference (block CGS2) and lagged (single-reduction DCGS2), instantiated for double and float.
+
+        template<typename scalar_t> scalar_t Ort_RmtRvtNNNN_R(scalar_t*, scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> scalar_t Lso_RmtRvtNNNNB_R(scalar_t*, scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&, const bool&);
+
+        #ifndef NVERBOSE
+
+        // Global reductions run by Ort_RmtRvtNNNN_R and Lso_RmtRvtNNNNB_R, counted for benchmarking, reset by their callers.
+
+        extern natural_t orthogonalization_reductions;
+
+        #endif
+
+        // sGMRES, instantiated for double and float, the precision of a solve being that of its vectors.
 
-        std::array<real_t, 2> sGMRES_RvNNvNvRvRvNN_RR(real_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*, const real_t*, const natural_t&, const natural_t&);
+        template<typename scalar_t> std::array<scalar_t, 2> sGMRES_RvNOpOfPwRvNN_RR(scalar_t*, const natural_t&, const operator_t<scalar_t>&, const fused_t<scalar_t>&, const powers_t<scalar_t>&, const scalar_t*, const natural_t&, const natural_t&);
+        template<typename scalar_t> std::array<scalar_t, 2> sGMRES_RvNNvOpOfPwRvNN_RR(scalar_t*, const natural_t&, const natural_t*, const operator_t<scalar_t>&, const fused_t<scalar_t>&, const powers_t<scalar_t>&, const scalar_t*, const natural_t&, const natural_t&);
+        template<typename index_t, typename scalar_t> std::array<scalar_t, 2> sGMRES_RvNNvNvRvRvNN_RR(scalar_t*, const natural_t&, const index_t*, const index_t*, const real_t*, const scalar_t*, const natural_t&, const natural_t&);
 
     }
 }
@@ -13,29 +13,183 @@
 
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "./Vectors.hpp"
 
 namespace nass {
     namespace internal {
 
-        // Load. [!] These two methods can be unified.
+        // (SELL-C-σ) chunk height, the same for every dispatched level (two 256-bit or one 512-bit registers of doubles), and sorting window.
 
-        [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*, real_t*> Spc_St_NNvNvRv(const std::string&);
-        [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*, real_t*> Spr_St_NNvNvRv(const std::string&);
+        constexpr natural_t sell_chunk = 8;
 
-        // Products.
+        constexpr natural_t sell_sigma = 32 * sell_chunk;
 
-        void Mlc_RvtNNvNvRvRv_0(real_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*, const real_t*);
-        void Mlr_RvtNNvNvRvRv_0(real_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*, const real_t*);
+        // (BCSR) block sizes, each with its own microkernel.
 
-        void RMlc_RvtNNvNvRvRvRv_0(real_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*, const real_t*, const real_t*);
+        constexpr natural_t block_sizes[] = {2, 3, 4, 6};
 
-        void Mlc_RmtNNNvNvRvRmN_0(real_t*, const natural_t&, const natural_t&, const natural_t*, const natural_t*, const real_t*, const real_t*, const natural_t&);
+        // (DIA) maximum number of diagonals.
 
-        // Embeddings.
+        constexpr natural_t dia_diagonals = 32;
 
-        [[nodiscard]] std::tuple<natural_t*, natural_t*, real_t*> Sec_NN_NvNvRv(const natural_t&, const natural_t&);
+        // Matrix powers kernel, products per sweep.
+
+        constexpr natural_t powers_steps = 4;
+
+        // Matrix powers kernel, rows computed per row owned, past which the plain operator is used instead.
+
+        constexpr natural_t powers_redundancy = 2;
+
+        // Matrix powers kernel, timed runs against as many products of the plain operator, which is used instead when faster.
+
+        constexpr natural_t powers_iterations = 5;
+
+        // Parallel (CSC) products, columns read by the row splitting, relative to the matrix, past which columns are split instead.
+
+        constexpr natural_t split_redundancy = 2;
+
+        // Embeddings' seed, fixed so that solves are reproducible.
+
+        constexpr natural_t sketch_seed = 5489;
+
+        // Load, instantiated for natural_t and natural32_t indices.
+
+        [[nodiscard]] std::tuple<natural_t, natural_t> Sz_St_NN(const std::string&);
+
+        template<typename index_t = natural_t> [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*, index_t*, index_t*, real_t*> Spcr_StBB_NNvNvRvNvNvRv(const std::string&, const bool&, const bool&);
+
+        template<typename index_t = natural_t> [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*> Spc_St_NNvNvRv(const std::string&);
+        template<typename index_t = natural_t> [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*> Spr_St_NNvNvRv(const std::string&);
+
+        // Symmetric load.
+
+        [[nodiscard]] bool Sym_St_B(const std::string&);
+        template<typename index_t = natural_t> [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*> Sps_St_NNvNvRv(const std::string&);
+
+        // Entries, original ordering.
+
+        [[nodiscard]] std::tuple<natural_t, natural_t, natural_t*, natural_t*, real_t*, bool> Coo_St_NNNvNvRvB(const std::string&);
+
+        // Compression.
+
+        template<typename index_t> [[nodiscard]] std::tuple<index_t*, index_t*, real_t*> Cmp_NNNvNvRv_NvNvRv(const natural_t&, const natural_t&, const index_t*, const index_t*, const real_t*);
+
+        // Narrowing, instantiated for natural32_t indices and float and double values.
+
+        [[nodiscard]] bool Nrw_NN_B(const natural_t&, const natural_t&);
+        template<typename index_t> [[nodiscard]] index_t* Nrw_NvN_Nv(const natural_t*, const natural_t&);
+        template<typename value_t> [[nodiscard]] value_t* Nrw_RvN_Rv(const real_t*, const natural_t&);
+
+        // Delta encoding.
+
+        template<typename index_t> [[nodiscard]] std::tuple<unsigned char*, natural_t> Dlt_NNvNv_CvN(const natural_t&, const index_t*, const index_t*);
+
+        // Numeric refresh, the pattern is built once per structure, derived layouts' ones by building them on tags.
+
+        template<typename index_t> [[nodiscard]] std::tuple<natural_t*, natural_t*> Ptn_NNvNvNNvNvBB_NvNv(const natural_t&, const index_t*, const index_t*, const natural_t&, const natural_t*, const natural_t*, const bool&, const bool&);
+
+        [[nodiscard]] natural_t* Tg_N_Nv(const natural_t&);
+        [[nodiscard]] std::tuple<natural_t*, natural_t*> Ptt_NvN_NvNv(const natural_t*, const natural_t&);
+
+        template<typename value_t> void Rfs_RvtNNvNvRv_0(value_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*);
+
+        // Derived layouts, refreshed from the values of their sparse matrix.
+
+        enum class layout_t {
+            copy, // Same positions: copies, first-touch copies and narrowed values.
+            permuted, // Prm_NNvNvRvNvB_NvNvRv.
+            csr, // Tr_NNvNvRv_NvNvRv.
+            sell, // Sel_NNvNvRv_NvNvNvRv.
+            bcsr, // Bcr_NNNvNvRv_NvNvRv.
+            dia // Dia_NNvNvRv_NIvRv.
+        };
+
+        struct derived_t {
+            real_t* Rv0; // Values, or nullptr.
+            value32_t* Rv1; // Narrowed values, or nullptr.
+
+            natural_t N0; // Slots.
+
+            natural_t* Nv0; // Pattern, pointers.
+            natural_t* Nv1; // Pattern, stored entries of the sparse matrix.
+        };
+
+        template<typename index_t, typename value_t> [[nodiscard]] derived_t Drv_RvNNvNvDLNNvB_D(value_t*, const natural_t&, const index_t*, const index_t*, const derived_t*, const layout_t&, const natural_t&, const natural_t*, const bool&);
+
+        void Rfd_DvRv_0(const std::vector<derived_t>&, const real_t*);
+        void Cld_Dv_0(std::vector<derived_t>&);
+
+        // Transposition.
+
+        template<typename index_t, typename value_t> [[nodiscard]] std::tuple<index_t*, index_t*, value_t*> Tr_NNvNvRv_NvNvRv(const natural_t&, const index_t*, const index_t*, const value_t*);
+
+        // Sliced ELLPACK.
+
+        template<typename index_t, typename value_t> [[nodiscard]] std::tuple<natural_t*, natural_t*, index_t*, value_t*> Sel_NNvNvRv_NvNvNvRv(const natural_t&, const index_t*, const index_t*, const value_t*);
+
+        // Register blocking.
+
+        template<typename index_t> [[nodiscard]] natural_t Blk_NNvNv_N(const natural_t&, const index_t*, const index_t*);
+        template<typename index_t, typename value_t> [[nodiscard]] std::tuple<index_t*, index_t*, value_t*> Bcr_NNNvNvRv_NvNvRv(const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*);
+
+        // Diagonals.
+
+        template<typename index_t, typename value_t> [[nodiscard]] std::tuple<natural_t, integer_t*, value_t*> Dia_NNvNvRv_NIvRv(const natural_t&, const index_t*, const index_t*, const value_t*);
+
+        // Reordering.
+
+        template<typename index_t> [[nodiscard]] natural_t* Rcm_NNvNv_Nv(const natural_t&, const index_t*, const index_t*);
+        template<typename index_t, typename value_t> [[nodiscard]] std::tuple<index_t*, index_t*, value_t*> Prm_NNvNvRvNvB_NvNvRv(const natural_t&, const index_t*, const index_t*, const value_t*, const natural_t*, const bool&);
+
+        template<typename scalar_t> void Prm_RvtRvNvN_0(scalar_t*, const scalar_t*, const natural_t*, const natural_t&);
+        template<typename scalar_t> void Ipr_RvtRvNvN_0(scalar_t*, const scalar_t*, const natural_t*, const natural_t&);
+
+        template<typename index_t> [[nodiscard]] std::tuple<natural_t, natural_t> Bnd_NNvNv_NN(const natural_t&, const index_t*, const index_t*);
+
+        // Row and column splitting, for parallel (CSC) and symmetric products.
+
+        template<typename index_t> [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*> Spl_NNvNv_NNvNv(const natural_t&, const index_t*, const index_t*);
+        template<typename index_t> [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*> Sps_NNvNvCv_NNvNv(const natural_t&, const index_t*, const index_t*, const unsigned char*);
+
+        // Products, instantiated for double and float values and scalars, accumulated in scalar_t.
+
+        template<typename index_t, typename value_t, typename scalar_t> void Mlc_RvtNNvNvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*);
+        template<typename index_t, typename value_t, typename scalar_t> void Mlc_RvtNNvNvRvRvNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&);
+        template<typename index_t, typename value_t, typename scalar_t> void Mlk_RvtRvtNNvNvRvRvNNvNvNNvNvRvRvt_0(scalar_t*, scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, const natural_t&, const natural_t*, const natural_t*, const scalar_t*, std::vector<scalar_t>&);
+
+        template<typename index_t, typename value_t, typename scalar_t> void Mlr_RvtNNvNvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*);
+        template<typename index_t, typename value_t, typename scalar_t> void Mls_RvtNNvNvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*);
+        template<typename index_t, typename value_t, typename scalar_t> void Mls_RvtNNvNvRvRvNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&);
+
+        template<typename index_t, typename value_t, typename scalar_t> void Mlc_RvtNNvCvRvRv_0(scalar_t*, const natural_t&, const index_t*, const unsigned char*, const value_t*, const scalar_t*);
+        template<typename index_t, typename value_t, typename scalar_t> void Mls_RvtNNvCvRvRv_0(scalar_t*, const natural_t&, const index_t*, const unsigned char*, const value_t*, const scalar_t*);
+        template<typename index_t, typename value_t, typename scalar_t> void Mls_RvtNNvCvRvRvNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const unsigned char*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&);
+
+        template<typename index_t, typename value_t, typename scalar_t> void Mle_RvtNNvNvNvRvRv_0(scalar_t*, const natural_t&, const natural_t*, const natural_t*, const index_t*, const value_t*, const scalar_t*);
+
+        template<typename index_t, typename value_t, typename scalar_t> void Mlb_RvtNNNvNvRvRv_0(scalar_t*, const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*);
+
+        template<typename value_t, typename scalar_t> void Mld_RvtNNIvRvRv_0(scalar_t*, const natural_t&, const natural_t&, const integer_t*, const value_t*, const scalar_t*);
+        template<typename value_t, typename scalar_t> void Mdk_RvtRvtNNIvRvRvNNvNvRvRvt_0(scalar_t*, scalar_t*, const natural_t&, const natural_t&, const integer_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, const scalar_t*, std::vector<scalar_t>&);
+
+        template<typename index_t, typename value_t, typename scalar_t> void RMlc_RvtNNvNvRvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const scalar_t*);
+
+        template<typename index_t, typename value_t, typename scalar_t> void Mlc_RmtNNNvNvRvRmNRvt_0(scalar_t*, const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, std::vector<scalar_t>&);
+        template<typename index_t, typename value_t, typename scalar_t> void Mlm_RmtNNNvNvRvRmN_0(scalar_t*, const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&);
+        template<typename index_t, typename value_t, typename scalar_t> void Mlm_RmtNNvNvRvRmNNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&);
+
+        // Matrix powers, (CSR) sparse matrices, scaled Newton basis.
+
+        template<typename index_t> [[nodiscard]] std::tuple<natural_t, natural_t*> Pwp_NNvNv_NNv(const natural_t&, const index_t*, const index_t*);
+        [[nodiscard]] real_t Pwr_NNNv_R(const natural_t&, const natural_t&, const natural_t*);
+        template<typename index_t> [[nodiscard]] real_t Pws_NNvRv_R(const natural_t&, const index_t*, const real_t*);
+        template<typename index_t, typename value_t, typename scalar_t> void Mpk_RmtNNvNvRvRvRvNNNvR_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t*, const scalar_t&);
+
+        // Embeddings, instantiated for double and float.
+
+        template<typename scalar_t> [[nodiscard]] std::tuple<natural_t*, natural_t*, scalar_t*> Sec_NNN_NvNvRv(const natural_t&, const natural_t&, const natural_t&);
 
     }
 }
@@ -0,0 +1,72 @@
+/**
+ * @file Tuner.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Per-matrix product autotuning, with a persisted decision cache.
+ * @date 2024-12-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef NASS_TUNER_HPP
+#define NASS_TUNER_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "./Core.hpp"
+
+namespace nass {
+    namespace internal {
+
+        // Kernels.
+
+        enum class kernel_t : std::uint32_t {
+            split, // Parallel (CSC), Mlc_RvtNNvNvRvRvNNvNvRvt_0.
+            csr, // (CSR), Mlr_RvtNNvNvRvRv_0.
+            sell, // (SELL-C-σ), Mle_RvtNNvNvNvRvRv_0.
+            bcsr, // (BCSR), Mlb_RvtNNNvNvRvRv_0.
+            dia, // (DIA), Mld_RvtNNIvRvRv_0.
+            delta, // Delta-encoded (CSC), Mlc_RvtNNvCvRvRv_0.
+            symmetric, // Symmetric (lower) storage, Mls_RvtNNvNvRvRv_0.
+            symmetric_delta // Delta-encoded symmetric (lower) storage, Mls_RvtNNvCvRvRv_0.
+        };
+
+        [[nodiscard]] std::string_view Nm_K_St(const kernel_t&);
+
+        // Structural statistics.
+
+        struct statistics_t {
+            natural_t N0; // Size.
+            natural_t N1; // Entries.
+
+            real_t R0; // Row length, mean.
+            real_t R1; // Row length, standard deviation.
+
+            natural_t N2; // Bandwidth.
+            natural_t N3; // Block size, 1 when unblocked.
+        };
+
+        template<typename index_t> [[nodiscard]] statistics_t Sts_NNvNvB_S(const natural_t&, const index_t*, const index_t*, const bool&);
+
+        // Fingerprint.
+
+        template<typename index_t> [[nodiscard]] std::uint64_t Fp_NNvNvB_N(const natural_t&, const index_t*, const index_t*, const bool&);
+
+        // Tuning, instantiated for natural_t and natural32_t indices.
+
+        template<typename index_t> [[nodiscard]] std::tuple<kernel_t, real_t> Tun_NNvNvRvBS_KR(const natural_t&, const index_t*, const index_t*, const real_t*, const bool&, const statistics_t&);
+
+        // Decision cache.
+
+        [[nodiscard]] std::tuple<kernel_t, bool> Ldt_StN_KB(const std::string&, const std::uint64_t&);
+        [[nodiscard]] bool Stt_StNK_B(const std::string&, const std::uint64_t&, const kernel_t&);
+
+        template<typename index_t> [[nodiscard]] std::tuple<kernel_t, bool> Atn_StNNvNvRvB_KB(const std::string&, const natural_t&, const index_t*, const index_t*, const real_t*, const bool&);
+
+    }
+}
+
+#endif
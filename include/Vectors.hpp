@@ -16,33 +16,46 @@
 namespace nass {
     namespace internal {
 
+        // Kernels, instantiated for double and float, bound at runtime (include/Dispatch.hpp).
+
         // Copy.
         
-        void Cp_RvtRvN_0(real_t*, const real_t*, const natural_t&);
+        template<typename scalar_t> void Cp_RvtRvN_0(scalar_t*, const scalar_t*, const natural_t&);
 
         // Operations.
 
         // Dot product.
 
-        real_t Dt_RvRvN_R(const real_t*, const real_t*, const natural_t&);
-        real_t NPDt_RvRvN_R(const real_t*, const real_t*, const natural_t&);
+        template<typename scalar_t> scalar_t Dt_RvRvN_R(const scalar_t*, const scalar_t*, const natural_t&);
+        template<typename scalar_t> scalar_t NPDt_RvRvN_R(const scalar_t*, const scalar_t*, const natural_t&);
 
         // Norm.
 
-        real_t Nr_RvN_R(const real_t*, const natural_t&);
-        void Nrz_RvtN_0(real_t*, const natural_t&);
+        template<typename scalar_t> scalar_t Nr_RvN_R(const scalar_t*, const natural_t&);
+        template<typename scalar_t> void Nrz_RvtN_0(scalar_t*, const natural_t&);
 
-        real_t NPNr_RvN_R(const real_t*, const natural_t&);
-        void NPNrz_RvtN_0(real_t*, const natural_t&);
+        template<typename scalar_t> scalar_t NPNr_RvN_R(const scalar_t*, const natural_t&);
+        template<typename scalar_t> void NPNrz_RvtN_0(scalar_t*, const natural_t&);
 
         // Projections.
         
-        void Prj_RvtRvRvN_0(real_t*, const real_t*, const real_t*, const natural_t&);
+        template<typename scalar_t> void Prj_RvtRvRvN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&);
+        template<typename scalar_t> scalar_t Prj_RvtRvRvN_R(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&);
+
+        // Block projections, on N2 columns of a basis stored in N3 rotating columns.
+
+        template<typename scalar_t> void Dtb_RvtRmRvNNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Prb_RvtRmRvNNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+
+        // Lagged block projections, single reduction.
+
+        template<typename scalar_t> void Dtl_RvtRmRvRvNNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&);
+        template<typename scalar_t> void Prl_RvtRvtRmRvNNNNRR_0(scalar_t*, scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&, const scalar_t&, const scalar_t&);
 
         // Output.
 
-        void Pr_RrvN_0(const real_t*, const natural_t&);
-        void Pr_RcvN_0(const real_t*, const natural_t&);
+        template<typename scalar_t> void Pr_RrvN_0(const scalar_t*, const natural_t&);
+        template<typename scalar_t> void Pr_RcvN_0(const scalar_t*, const natural_t&);
 
     }
 }
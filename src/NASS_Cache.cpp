@@ -0,0 +1,388 @@
+/**
+ * @file NASS_Cache.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Cache.hpp implementations.
+ * @date 2024-12-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/Cache.hpp"
+
+// Layout.
+//
+// [Header, 128B][Nv0, (N0 + 1) index_t][Pad][Nv1, N1 index_t][Pad][Rv0, N1 real_t]
+//
+// Every section starts on a CACHE_ALIGNMENT boundary so that the mapped arrays can be used in place.
+
+#define CACHE_VERSION 2
+#define CACHE_ALIGNMENT 64
+#define CACHE_BLOCK (1 << 20)
+
+namespace nass {
+    namespace internal {
+
+        /**
+         * @brief Cache header.
+         * 
+         */
+        struct cache_header_t {
+            char Cv0[8]; // Magic.
+
+            std::uint32_t I0; // Version.
+            std::uint32_t I1; // sizeof(index_t).
+            std::uint32_t I2; // sizeof(real_t).
+            std::uint32_t I3; // Flags, symmetric (lower) storage.
+
+            std::uint64_t I4; // Size.
+            std::uint64_t I5; // Entries.
+
+            std::uint64_t I6; // Nv0 offset.
+            std::uint64_t I7; // Nv1 offset.
+            std::uint64_t I8; // Rv0 offset.
+            std::uint64_t I9; // File size.
+
+            std::uint64_t I10; // Checksum.
+
+            char Cv1[128 - 80]; // Padding.
+        };
+
+        static_assert(sizeof(cache_header_t) == 128);
+        static_assert(sizeof(cache_header_t) % CACHE_ALIGNMENT == 0);
+
+        static constexpr char cache_magic[8] = {'N', 'A', 'S', 'S', 'C', 'S', 'C', '\0'};
+
+
+        /**
+         * @brief Aligns an offset.
+         * 
+         * @param N0 Natural number [N].
+         * @return natural_t Natural number [N].
+         */
+        static inline natural_t Al_N_N(const natural_t& N0) {
+            return (N0 + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT;
+        }
+
+
+        /**
+         * @brief Checks the layout of a header against its sizes and a file size.
+         * Sizes are bounded by the file size first, so that offsets cannot overflow.
+         * 
+         * @param H0 Header.
+         * @param N0 Natural number [N], file size.
+         * @return bool Boolean [B], consistent layout.
+         */
+        static bool Lyt_HN_B(const cache_header_t& H0, const natural_t& N0) {
+            if(H0.I9 != N0 || H0.I6 != sizeof(cache_header_t) || H0.I3 > 1 || (H0.I1 != sizeof(natural32_t) && H0.I1 != sizeof(natural_t)) || H0.I2 != sizeof(real_t))
+                return false;
+
+            if(H0.I4 >= N0 / H0.I1 || H0.I5 > N0 / H0.I1 || H0.I5 > N0 / H0.I2)
+                return false;
+
+            return H0.I7 == Al_N_N(H0.I6 + (H0.I4 + 1) * H0.I1) && H0.I8 == Al_N_N(H0.I7 + H0.I5 * H0.I1) && H0.I8 <= N0 && H0.I9 == H0.I8 + H0.I5 * H0.I2;
+        }
+
+
+        /**
+         * @brief FNV-1a hash of a byte range.
+         * 
+         * @param C0 Bytes.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], seed.
+         * @return std::uint64_t Hash.
+         */
+        static inline std::uint64_t Fnv_CvNN_N(const unsigned char* C0, const natural_t& N0, const std::uint64_t& N1) {
+            std::uint64_t N2 = N1;
+
+            for(natural_t N3 = 0; N3 < N0; ++N3) {
+                N2 ^= C0[N3];
+                N2 *= 0x100000001B3ULL;
+            }
+
+            return N2;
+        }
+
+
+        /**
+         * @brief Checksum of a byte range, hashed in independent blocks and then combined in order.
+         * 
+         * @param C0 Bytes.
+         * @param N0 Natural number [N].
+         * @return std::uint64_t Checksum.
+         */
+        [[nodiscard]] std::uint64_t Ck_CvN_N(const unsigned char* C0, const natural_t& N0) {
+            const natural_t N1 = (N0 + CACHE_BLOCK - 1) / CACHE_BLOCK;
+            std::uint64_t* Nv0 = new std::uint64_t[N1];
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N1; ++N2) {
+                const natural_t N3 = N2 * CACHE_BLOCK;
+                const natural_t N4 = N0 - N3 < CACHE_BLOCK ? N0 - N3 : CACHE_BLOCK;
+
+                Nv0[N2] = Fnv_CvNN_N(C0 + N3, N4, 0xCBF29CE484222325ULL);
+            }
+
+            const std::uint64_t N2 = Fnv_CvNN_N(reinterpret_cast<const unsigned char*>(Nv0), N1 * sizeof(std::uint64_t), 0xCBF29CE484222325ULL);
+
+            delete[] Nv0;
+
+            return N2;
+        }
+
+
+        /**
+         * @brief Writes a byte range at an offset, retrying short writes.
+         * 
+         * @param I0 File descriptor.
+         * @param C0 Bytes.
+         * @param N0 Natural number [N], bytes.
+         * @param N1 Natural number [N], offset.
+         * @return bool Boolean [B], success.
+         */
+        static bool Pw_ICvNN_B(const int I0, const unsigned char* C0, natural_t N0, natural_t N1) {
+            while(N0 > 0) {
+                const ssize_t I1 = pwrite(I0, C0, N0, static_cast<off_t>(N1));
+
+                if(I1 <= 0)
+                    return false;
+
+                C0 += I1; N0 -= I1; N1 += I1;
+            }
+
+            return true;
+        }
+
+
+        /**
+         * @brief Writes a header and its sections as a binary cache, sections being written in place from the caller's arrays.
+         * The padding is left as a hole, read back as zeros, and the checksum is taken on the written file.
+         * The file is written under a unique temporary name and renamed, so readers never map a partial file and concurrent writers never share one.
+         * 
+         * @param St0 String [St].
+         * @param H0 Header, completed by the checksum.
+         * @param C0 Bytes, Nv0 section.
+         * @param C1 Bytes, Nv1 section.
+         * @param C2 Bytes, Rv0 section.
+         * @return bool Boolean [B], success.
+         */
+        static bool Wrb_StHCvCvCv_B(const std::string& St0, cache_header_t H0, const unsigned char* C0, const unsigned char* C1, const unsigned char* C2) {
+            std::string St1 = St0 + ".XXXXXX";
+            const int I0 = mkstemp(St1.data());
+
+            if(I0 < 0)
+                return false;
+
+            // Sections, header last.
+            bool B0 = fchmod(I0, 0644) == 0 && ftruncate(I0, static_cast<off_t>(H0.I9)) == 0;
+
+            B0 = B0 && Pw_ICvNN_B(I0, C0, (H0.I4 + 1) * H0.I1, H0.I6);
+            B0 = B0 && Pw_ICvNN_B(I0, C1, H0.I5 * H0.I1, H0.I7);
+            B0 = B0 && Pw_ICvNN_B(I0, C2, H0.I5 * H0.I2, H0.I8);
+
+            // Checksum, through the page cache.
+            void* V0 = B0 ? mmap(nullptr, H0.I9, PROT_READ, MAP_SHARED, I0, 0) : MAP_FAILED;
+
+            if(V0 != MAP_FAILED) {
+                H0.I10 = Ck_CvN_N(static_cast<const unsigned char*>(V0) + sizeof(cache_header_t), H0.I9 - sizeof(cache_header_t));
+                munmap(V0, H0.I9);
+            } else
+                B0 = false;
+
+            B0 = B0 && Pw_ICvNN_B(I0, reinterpret_cast<const unsigned char*>(&H0), sizeof(cache_header_t), 0);
+            B0 = (close(I0) == 0) && B0;
+
+            if(!B0 || std::rename(St1.c_str(), St0.c_str()) != 0) {
+                std::remove(St1.c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+
+        /**
+         * @brief Stores a (CSC) sparse matrix into a binary cache.
+         * 
+         * @param St0 String [St].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param B0 Boolean [B], symmetric (lower) storage.
+         * @tparam index_t Index type.
+         * @return bool Boolean [B], success.
+         */
+        template<typename index_t>
+        [[nodiscard]] bool Stb_StNNvNvRvB_B(const std::string& St0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const bool& B0) {
+            const natural_t N1 = Nv0[N0];
+
+            // Header.
+            cache_header_t H0{};
+
+            std::memcpy(H0.Cv0, cache_magic, sizeof(cache_magic));
+
+            H0.I0 = CACHE_VERSION;
+            H0.I1 = sizeof(index_t);
+            H0.I2 = sizeof(real_t);
+            H0.I3 = B0 ? 1 : 0;
+
+            H0.I4 = N0;
+            H0.I5 = N1;
+
+            H0.I6 = sizeof(cache_header_t);
+            H0.I7 = Al_N_N(H0.I6 + (N0 + 1) * sizeof(index_t));
+            H0.I8 = Al_N_N(H0.I7 + N1 * sizeof(index_t));
+            H0.I9 = H0.I8 + N1 * sizeof(real_t);
+
+            return Wrb_StHCvCvCv_B(St0, H0, reinterpret_cast<const unsigned char*>(Nv0), reinterpret_cast<const unsigned char*>(Nv1), reinterpret_cast<const unsigned char*>(Rv0));
+        }
+
+
+        /**
+         * @brief Loads a (CSC) sparse matrix from a binary cache, in place.
+         * The arrays point into a shared read-only mapping and must be released with Clb_Nv_0.
+         * Returns a zero size on a missing, corrupted or incompatible cache, including one stored with a different index type.
+         * The header and section layout are always checked, the checksum, which reads the whole file, only without NDEBUG; it is taken when the cache is written.
+         * 
+         * @param St0 String [St].
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, const index_t*, const index_t*, const real_t*, bool> (CSC) sparse matrix [Spc], symmetric (lower) storage.
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, const index_t*, const index_t*, const real_t*, bool> Ldb_St_NNvNvRvB(const std::string& St0) {
+            const int I0 = open(St0.c_str(), O_RDONLY);
+
+            if(I0 < 0)
+                return {0, nullptr, nullptr, nullptr, false};
+
+            struct stat S0;
+            cache_header_t H0;
+
+            const natural_t N0 = fstat(I0, &S0) == 0 ? static_cast<natural_t>(S0.st_size) : 0;
+
+            // Header check.
+            if(N0 < sizeof(cache_header_t) || pread(I0, &H0, sizeof(cache_header_t), 0) != sizeof(cache_header_t) || std::memcmp(H0.Cv0, cache_magic, sizeof(cache_magic)) != 0 ||
+                H0.I0 != CACHE_VERSION || H0.I1 != sizeof(index_t) || !Lyt_HN_B(H0, N0)) {
+                close(I0);
+                return {0, nullptr, nullptr, nullptr, false};
+            }
+
+            // Shared mapping, pages are shared between processes through the page cache.
+            void* V0 = mmap(nullptr, N0, PROT_READ, MAP_SHARED, I0, 0);
+            close(I0);
+
+            if(V0 == MAP_FAILED)
+                return {0, nullptr, nullptr, nullptr, false};
+
+            const unsigned char* C0 = static_cast<const unsigned char*>(V0);
+
+            // Pointers, a cache whose pointers do not span its entries is treated as missing.
+            bool B0 = reinterpret_cast<const index_t*>(C0 + H0.I6)[0] == 0 && reinterpret_cast<const index_t*>(C0 + H0.I6)[H0.I4] == H0.I5;
+
+            #ifndef NDEBUG // Checksum, a corrupted cache is treated as missing.
+            B0 = B0 && Ck_CvN_N(C0 + sizeof(cache_header_t), N0 - sizeof(cache_header_t)) == H0.I10;
+            #endif
+
+            if(!B0) {
+                munmap(V0, N0);
+                return {0, nullptr, nullptr, nullptr, false};
+            }
+
+            return {
+                static_cast<natural_t>(H0.I4),
+                reinterpret_cast<const index_t*>(C0 + H0.I6),
+                reinterpret_cast<const index_t*>(C0 + H0.I7),
+                reinterpret_cast<const real_t*>(C0 + H0.I8),
+                (H0.I3 & 1) != 0
+            };
+        }
+
+
+        /**
+         * @brief Refreshes the values of a binary cache, copying its structure as stored.
+         * As on loading, the checksum of the stored cache is only checked without NDEBUG.
+         * 
+         * @param St0 String [St].
+         * @param N0 Natural number [N], entries.
+         * @param Rv0 Real vector [Rv].
+         * @return bool Boolean [B], success.
+         */
+        [[nodiscard]] bool Rfb_StNRv_B(const std::string& St0, const natural_t& N0, const real_t* Rv0) {
+            const int I0 = open(St0.c_str(), O_RDONLY);
+
+            if(I0 < 0)
+                return false;
+
+            struct stat S0;
+            cache_header_t H0;
+
+            const natural_t N1 = fstat(I0, &S0) == 0 ? static_cast<natural_t>(S0.st_size) : 0;
+
+            // Header check.
+            if(N1 < sizeof(cache_header_t) || pread(I0, &H0, sizeof(cache_header_t), 0) != sizeof(cache_header_t) || std::memcmp(H0.Cv0, cache_magic, sizeof(cache_magic)) != 0 ||
+                H0.I0 != CACHE_VERSION || H0.I5 != N0 || !Lyt_HN_B(H0, N1)) {
+                close(I0);
+                return false;
+            }
+
+            void* V0 = mmap(nullptr, N1, PROT_READ, MAP_PRIVATE, I0, 0);
+            close(I0);
+
+            if(V0 == MAP_FAILED)
+                return false;
+
+            // Structure as stored, values from the caller, unless the cache is corrupted.
+            const unsigned char* C0 = static_cast<const unsigned char*>(V0);
+            bool B0 = true;
+
+            #ifndef NDEBUG // Checksum, a corrupted cache is not refreshed.
+            B0 = Ck_CvN_N(C0 + sizeof(cache_header_t), N1 - sizeof(cache_header_t)) == H0.I10;
+            #endif
+
+            B0 = B0 && Wrb_StHCvCvCv_B(St0, H0, C0 + H0.I6, C0 + H0.I7, reinterpret_cast<const unsigned char*>(Rv0));
+
+            munmap(V0, N1);
+
+            return B0;
+        }
+
+
+        /**
+         * @brief Releases a binary cache given its first array.
+         * 
+         * @param Nv0 Natural vector [Nv].
+         * @tparam index_t Index type.
+         */
+        template<typename index_t>
+        void Clb_Nv_0(const index_t* Nv0) {
+            const unsigned char* C0 = reinterpret_cast<const unsigned char*>(Nv0) - sizeof(cache_header_t);
+            const cache_header_t* H0 = reinterpret_cast<const cache_header_t*>(C0);
+
+            munmap(const_cast<unsigned char*>(C0), H0->I9);
+        }
+
+
+        // Instantiations.
+
+        #define NASS_CACHE_INSTANTIATE(index_t) \
+            template bool Stb_StNNvNvRvB_B(const std::string&, const natural_t&, const index_t*, const index_t*, const real_t*, const bool&); \
+            template std::tuple<natural_t, const index_t*, const index_t*, const real_t*, bool> Ldb_St_NNvNvRvB(const std::string&); \
+            template void Clb_Nv_0(const index_t*);
+
+        NASS_CACHE_INSTANTIATE(natural_t)
+        NASS_CACHE_INSTANTIATE(natural32_t)
+
+        #undef NASS_CACHE_INSTANTIATE
+
+    }
+}
\ No newline at end of file
@@ -30,13 +30,15 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Pv_RmtNvtNNN_0(real_t* Rmt0, natural_t* Nvt0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
-            real_t R0 = NPNr_RvN_R(Rmt0 + N2 * (N0 + 1), N0 - N2);
+        template<typename scalar_t>
+        void Pv_RmtNvtNNN_0(scalar_t* Rmt0, natural_t* Nvt0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+            scalar_t R0 = NPNr_RvN_R(Rmt0 + N2 * (N0 + 1), N0 - N2);
             natural_t N3 = N2;
 
             for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
-                const real_t R1 = NPNr_RvN_R(Rmt0 + N4 * N0 + N2, N0 - N2);
+                const scalar_t R1 = NPNr_RvN_R(Rmt0 + N4 * N0 + N2, N0 - N2);
 
                 if(R1 > R0) {
                     R0 = R1;
@@ -61,13 +63,15 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Lh_RmtRvNNN_0(real_t* Rmt0, const real_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+        template<typename scalar_t>
+        void Lh_RmtRvNNN_0(scalar_t* Rmt0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
             for(natural_t N3 = N0 - N2; N3 < N1; ++N3) {
                 const natural_t N4 = N3 * N0;
                 const natural_t N5 = N0 - N2;
 
-                const real_t R0 = 2.0 * NPDt_RvRvN_R(Rmt0 + N4 + N5, Rv0 + N5, N2);
+                const scalar_t R0 = 2.0 * NPDt_RvRvN_R(Rmt0 + N4 + N5, Rv0 + N5, N2);
 
                 for(natural_t N6 = N0 - N2; N6 < N0; ++N6)
                     Rmt0[N4 + N6] -= Rv0[N6] * R0;
@@ -83,10 +87,12 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Mq_RvtRmNN_0(real_t* Rvt0, const real_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+        template<typename scalar_t>
+        void Mq_RvtRmNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
             for(natural_t N3 = N1; N3 > 0; --N3) {
-                const real_t R0 = 2.0 * NPDt_RvRvN_R(Rm0 + (N3 - 1) * (N0 + 1), Rvt0 + (N3 - 1), N0 - (N3 - 1));
+                const scalar_t R0 = 2.0 * NPDt_RvRvN_R(Rm0 + (N3 - 1) * (N0 + 1), Rvt0 + (N3 - 1), N0 - (N3 - 1));
 
                 for(natural_t N4 = N3 - 1; N4 < N0; ++N4)
                     Rvt0[N4] -= R0 * Rm0[(N3 - 1) * N0 + N4];
@@ -102,10 +108,12 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Mqt_RvtRmNN_0(real_t* Rvt0, const real_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+        template<typename scalar_t>
+        void Mqt_RvtRmNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
             for(natural_t N3 = 0; N3 < N1; ++N3) {
-                const real_t R0 = 2.0 * NPDt_RvRvN_R(Rm0 + N3 * (N0 + 1), Rvt0 + N3, N0 - N3);
+                const scalar_t R0 = 2.0 * NPDt_RvRvN_R(Rm0 + N3 * (N0 + 1), Rvt0 + N3, N0 - N3);
 
                 for(natural_t N4 = N3; N4 < N0; ++N4)
                     Rvt0[N4] -= R0 * Rm0[N3 * N0 + N4];
@@ -123,8 +131,10 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void TQR_RmtRmtNvtNN_0(real_t* Rmt0, real_t* Rmt1, natural_t* Nvt0, const natural_t& N0, const natural_t& N1) {
+        template<typename scalar_t>
+        void TQR_RmtRmtNvtNN_0(scalar_t* Rmt0, scalar_t* Rmt1, natural_t* Nvt0, const natural_t& N0, const natural_t& N1) {
             #ifndef NDEBUG // Integrity check.
             assert(N1 < N0 - 1);
             #endif
@@ -134,7 +144,7 @@ namespace nass {
                 Nvt0[N2] = N2;
 
             // Column.
-            real_t* Rv0 = new real_t[N0];
+            scalar_t* Rv0 = new scalar_t[N0];
 
             // First column.
 
@@ -181,5 +191,20 @@ namespace nass {
             delete[] Rv0;
         }
 
+
+        // Instantiations.
+
+        #define NASS_DECOMPOSITION_INSTANTIATE(scalar_t) \
+            template void Pv_RmtNvtNNN_0(scalar_t*, natural_t*, const natural_t&, const natural_t&, const natural_t&); \
+            template void Lh_RmtRvNNN_0(scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&); \
+            template void Mq_RvtRmNN_0(scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&); \
+            template void Mqt_RvtRmNN_0(scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&); \
+            template void TQR_RmtRmtNvtNN_0(scalar_t*, scalar_t*, natural_t*, const natural_t&, const natural_t&);
+
+        NASS_DECOMPOSITION_INSTANTIATE(double)
+        NASS_DECOMPOSITION_INSTANTIATE(float)
+
+        #undef NASS_DECOMPOSITION_INSTANTIATE
+
     }
 }
\ No newline at end of file
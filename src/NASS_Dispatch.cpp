@@ -0,0 +1,152 @@
+/**
+ * @file NASS_Dispatch.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Dispatch.hpp implementations.
+ * @date 2024-12-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <cstdlib>
+#include <type_traits>
+
+#include "../include/Dispatch.hpp"
+
+namespace nass {
+    namespace internal {
+
+        /**
+         * @brief Name of an instruction set level.
+         * 
+         * @param I0 Instruction set level [I].
+         * @return std::string_view String [St].
+         */
+        [[nodiscard]] std::string_view Nm_I_St(const isa_t& I0) {
+            switch(I0) {
+                case isa_t::neon: return "neon";
+                case isa_t::avx2: return "avx2";
+                case isa_t::avx512: return "avx512";
+                default: return "scalar";
+            }
+        }
+
+
+        /**
+         * @brief Levels supported by the CPU, read once (CPUID), from the lowest to the highest.
+         * 
+         * @return const std::vector<isa_t>& Instruction set levels [Iv].
+         */
+        [[nodiscard]] const std::vector<isa_t>& Lvs_0_Iv() {
+            static const std::vector<isa_t> Iv0 = []() {
+                std::vector<isa_t> Iv1;
+
+                #if defined(__x86_64__)
+
+                // Checks the OS support (XGETBV) too.
+                __builtin_cpu_init();
+
+                Iv1.push_back(isa_t::scalar);
+
+                if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                    Iv1.push_back(isa_t::avx2);
+
+                    if(__builtin_cpu_supports("avx512f"))
+                        Iv1.push_back(isa_t::avx512);
+                }
+
+                #elif defined(__aarch64__) && !defined(NNEON)
+
+                // Mandatory on AArch64.
+                Iv1.push_back(isa_t::neon);
+
+                #else
+
+                Iv1.push_back(isa_t::scalar);
+
+                #endif
+
+                return Iv1;
+            }();
+
+            return Iv0;
+        }
+
+
+        /**
+         * @brief Highest level supported by the CPU, or the one named by the NASS_ISA environment variable when supported, read once.
+         * 
+         * @return isa_t Instruction set level [I].
+         */
+        [[nodiscard]] isa_t Isa_0_I() {
+            static const isa_t I0 = []() {
+                const std::vector<isa_t>& Iv0 = Lvs_0_Iv();
+                const char* Cv0 = std::getenv("NASS_ISA");
+
+                if(Cv0 != nullptr)
+                    for(natural_t N0 = Iv0.size(); N0 > 0; --N0)
+                        if(Nm_I_St(Iv0[N0 - 1]) == Cv0)
+                            return Iv0[N0 - 1];
+
+                return Iv0.back();
+            }();
+
+            return I0;
+        }
+
+
+        /**
+         * @brief Vector kernels of a level, the level must be supported.
+         * 
+         * @param I0 Instruction set level [I].
+         * @return const vectors_t<scalar_t>& Vector kernels [Vt].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        [[nodiscard]] const vectors_t<scalar_t>& Vct_I_Vt(const isa_t& I0) {
+            constexpr bool B0 = std::is_same_v<scalar_t, double>;
+
+            #if defined(__x86_64__)
+
+            switch(I0) {
+                case isa_t::avx512: if constexpr(B0) return vectors_avx512_64; else return vectors_avx512_32;
+                case isa_t::avx2: if constexpr(B0) return vectors_avx2_64; else return vectors_avx2_32;
+                default: if constexpr(B0) return vectors_scalar_64; else return vectors_scalar_32;
+            }
+
+            #elif defined(__aarch64__) && !defined(NNEON)
+
+            if constexpr(B0) return vectors_neon_64; else return vectors_neon_32;
+
+            #else
+
+            if constexpr(B0) return vectors_scalar_64; else return vectors_scalar_32;
+
+            #endif
+        }
+
+
+        /**
+         * @brief Vector kernels, bound once, on first use, to the selected level.
+         * 
+         * @return const vectors_t<scalar_t>& Vector kernels [Vt].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        [[nodiscard]] const vectors_t<scalar_t>& Vct_0_Vt() {
+            static const vectors_t<scalar_t>& Vt0 = Vct_I_Vt<scalar_t>(Isa_0_I());
+
+            return Vt0;
+        }
+
+
+        // Instantiations.
+
+        template const vectors_t<double>& Vct_I_Vt(const isa_t&);
+        template const vectors_t<float>& Vct_I_Vt(const isa_t&);
+
+        template const vectors_t<double>& Vct_0_Vt();
+        template const vectors_t<float>& Vct_0_Vt();
+
+    }
+}
@@ -0,0 +1,755 @@
+/**
+ * @file NASS_Kernels.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Dispatch.hpp vector kernels, compiled once per instruction set level.
+ * @date 2024-12-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+// Reals.hpp and builtins only, inline library code used here would be shared with the other levels by the linker.
+#include "../include/Reals.hpp"
+#include "../include/Dispatch.hpp"
+
+// Level, from the target flags of this translation unit.
+
+#if defined(_NEON)
+#define KERNELS_LEVEL neon
+#elif defined(_AVX) && defined(AVX512)
+#define KERNELS_LEVEL avx512
+#elif defined(_AVX)
+#define KERNELS_LEVEL avx2
+#else
+#define KERNELS_LEVEL scalar
+#endif
+
+#define KERNELS_TABLE(I, N) KERNELS_TABLE_(I, N)
+#define KERNELS_TABLE_(I, N) vectors_ ## I ## _ ## N
+
+// Block projections: rows per block, kept in cache across the columns.
+#define PROJECTION_BLOCK 2048
+
+namespace nass {
+    namespace internal {
+        
+        /**
+         * @brief Copy a real_t* into a real_t*, both of size N0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Cp_RvtRvN_0(scalar_t* Rvt0, const scalar_t* Rv0, const natural_t& N0) {
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                #pragma omp parallel for
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0));
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1));
+                }
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
+                    Rvt0[N1] = Rv0[N1];
+
+                return;
+            }
+            #endif
+
+            #ifdef _OPENMP
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                Rvt0[N1] = Rv0[N1];
+                Rvt0[N1 + 1] = Rv0[N1 + 1];
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
+                Rvt0[N1] = Rv0[N1];
+
+            #else
+            memcpy(Rvt0, Rv0, N0 * sizeof(scalar_t));
+            #endif
+        }
+
+
+        /**
+         * @brief Dot product between two real_t*, both of size N0.
+         * 
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @return scalar_t Real number [R].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static scalar_t Dt_RvRvN_R(const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
+
+                #pragma omp parallel for reduction(Rd_Rs: Rs0, Rs1)
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs00 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs01 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
+
+                    const reals_t Rs10 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs11 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_1);
+
+                    Rs0 = Fma_RsRsRs_Rs(Rs0, Rs00, Rs10);
+                    Rs1 = Fma_RsRsRs_Rs(Rs1, Rs01, Rs11);
+                }
+
+                scalar_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
+                    R0 += Rv0[N1] * Rv1[N1];
+
+                return R0;
+            }
+            #endif
+
+            scalar_t R0 = 0.0, R1 = 0.0;
+
+            #pragma omp parallel for reduction(+: R0, R1)
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                R0 += Rv0[N1] * Rv1[N1];
+                R1 += Rv0[N1 + 1] * Rv1[N1 + 1];
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
+                R0 += Rv0[N1] * Rv1[N1];
+
+            return R0 + R1;
+        }
+
+
+        /**
+         * @brief Non-parallel dot product between two real_t*, both of size N0.
+         * 
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @return scalar_t Real number [R].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static scalar_t NPDt_RvRvN_R(const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            natural_t N1 = 0;
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
+
+                for(; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs00 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs01 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
+
+                    const reals_t Rs10 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs11 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_1);
+
+                    Rs0 = Fma_RsRsRs_Rs(Rs0, Rs00, Rs10);
+                    Rs1 = Fma_RsRsRs_Rs(Rs1, Rs01, Rs11);
+                }
+
+                scalar_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
+
+                for(; N1 < N0; ++N1)
+                    R0 += Rv0[N1] * Rv1[N1];
+
+                return R0;
+            }
+            #endif
+
+            scalar_t R0 = 0.0, R1 = 0.0;
+
+            for(; N1 < N0 - 1; N1 += 2) {
+                R0 += Rv0[N1] * Rv1[N1];
+                R1 += Rv0[N1 + 1] * Rv1[N1 + 1];
+            }
+
+            for(; N1 < N0; ++N1)
+                R0 += Rv0[N1] * Rv1[N1];
+
+            return R0 + R1;
+        }
+
+
+        /**
+         * @brief Norm of a real_t*.
+         * 
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @return scalar_t 
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static scalar_t Nr_RvN_R(const scalar_t* Rv0, const natural_t& N0) {
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
+
+                #pragma omp parallel for reduction(Rd_Rs: Rs0, Rs1)
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs2 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs3 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
+
+                    Rs0 = Fma_RsRsRs_Rs(Rs0, Rs2, Rs2);
+                    Rs1 = Fma_RsRsRs_Rs(Rs1, Rs3, Rs3);
+                }
+
+                scalar_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1) {
+                    const scalar_t R3 = Rv0[N1];
+
+                    R0 += R3 * R3;
+                }
+
+                return std::sqrt(R0);
+            }
+            #endif
+
+            scalar_t R0 = 0.0, R1 = 0.0;
+
+            #pragma omp parallel for reduction(+: R0, R1)
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                const scalar_t R3 = Rv0[N1], R4 = Rv0[N1 + 1];
+
+                R0 += R3 * R3;
+                R1 += R4 * R4;
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1) {
+                const scalar_t R3 = Rv0[N1];
+
+                R0 += R3 * R3;
+            }
+
+            return std::sqrt(R0 + R1);
+        }
+
+
+        /**
+         * @brief Normalization of a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Nrz_RvtN_0(scalar_t* Rvt0, const natural_t& N0) {
+            const scalar_t R0 = Nr_RvN_R(Rvt0, N0);
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                const reals_t Rs0 = Ex_R_Rs(1.0 / R0); // Reciprocal, vector divisions are not pipelined.
+
+                #pragma omp parallel for
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs1 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs2 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1);
+
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Ml_RsRs_Rs(Rs1, Rs0));
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Ml_RsRs_Rs(Rs2, Rs0));
+                }
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
+                    Rvt0[N1] /= R0;
+
+                return;
+            }
+            #endif
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                Rvt0[N1] /= R0;
+                Rvt0[N1 + 1] /= R0;
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
+                Rvt0[N1] /= R0;
+        }
+
+
+        /**
+         * @brief Non-parallel norm of a real_t*.
+         * 
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @return scalar_t 
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static scalar_t NPNr_RvN_R(const scalar_t* Rv0, const natural_t& N0) {
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
+
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs2 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs3 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
+
+                    Rs0 = Fma_RsRsRs_Rs(Rs0, Rs2, Rs2);
+                    Rs1 = Fma_RsRsRs_Rs(Rs1, Rs3, Rs3);
+                }
+
+                scalar_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1) {
+                    const scalar_t R3 = Rv0[N1];
+
+                    R0 += R3 * R3;
+                }
+
+                return std::sqrt(R0);
+            }
+            #endif
+
+            scalar_t R0 = 0.0, R1 = 0.0;
+
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                const scalar_t R3 = Rv0[N1], R4 = Rv0[N1 + 1];
+
+                R0 += R3 * R3;
+                R1 += R4 * R4;
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1) {
+                const scalar_t R3 = Rv0[N1];
+
+                R0 += R3 * R3;
+            }
+
+            return std::sqrt(R0 + R1);
+        }
+
+
+        /**
+         * @brief Non-parallel normalization of a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void NPNrz_RvtN_0(scalar_t* Rvt0, const natural_t& N0) {
+            const scalar_t R0 = Nr_RvN_R(Rvt0, N0);
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                const reals_t Rs0 = Ex_R_Rs(1.0 / R0); // Reciprocal, vector divisions are not pipelined.
+
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs1 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs2 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1);
+
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Ml_RsRs_Rs(Rs1, Rs0));
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Ml_RsRs_Rs(Rs2, Rs0));
+                }
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
+                    Rvt0[N1] /= R0;
+
+                return;
+            }
+            #endif
+
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                Rvt0[N1] /= R0;
+                Rvt0[N1 + 1] /= R0;
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
+                Rvt0[N1] /= R0;
+        }
+
+
+        /**
+         * @brief Projection onto a real_t*, returning its coefficient.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @return scalar_t Real number [R].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static scalar_t Prj_RvtRvRvN_R(scalar_t* Rvt0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            const scalar_t R0 = Dt_RvRvN_R(Rv0, Rv1, N0);
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                const reals_t Rs0 = Ex_R_Rs(R0);
+
+                #pragma omp parallel for
+                for(natural_t N1 = 0; N1 < N0 - (N0 % LOOP_OFFSET); N1 += LOOP_OFFSET) {
+                    const reals_t Rs1 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs2 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1);
+
+                    const reals_t Rs3 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
+                    const reals_t Rs4 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
+
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Fms_RsRsRs_Rs(Rs1, Rs3, Rs0));
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Fms_RsRsRs_Rs(Rs2, Rs4, Rs0));
+                }
+
+                for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1) {
+                    Rvt0[N1] -= R0 * Rv0[N1];
+                }
+
+                return R0;
+            }
+            #endif
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
+                Rvt0[N1] -= R0 * Rv0[N1];
+                Rvt0[N1 + 1] -= R0 * Rv0[N1 + 1];
+            }
+
+            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1) {
+                Rvt0[N1] -= R0 * Rv0[N1];
+            }
+
+            return R0;
+        }
+
+
+        /**
+         * @brief Scaled accumulation of a real_t*, Rvt0 += R0 * Rv0, sequential.
+         * Row update of the multivector products, called within their parallel regions.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param R0 Real number [R].
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Axm_RvtRRvN_0(scalar_t* Rvt0, const scalar_t& R0, const scalar_t* Rv0, const natural_t& N0) {
+            natural_t N1 = 0;
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>) {
+                const reals_t Rs0 = Ex_R_Rs(R0);
+
+                for(; N1 + LOOP_OFFSET <= N0; N1 += LOOP_OFFSET) {
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Fma_RsRsRs_Rs(Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0), Rs0, Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0)));
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Fma_RsRsRs_Rs(Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1), Rs0, Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1)));
+                }
+            }
+            #endif
+
+            for(; N1 < N0; ++N1)
+                Rvt0[N1] += R0 * Rv0[N1];
+        }
+
+
+        /**
+         * @brief Element-wise accumulation of a product, Rvt0 += Rv0 * Rv1, sequential.
+         * Diagonal update of the (DIA) products, called within their parallel regions.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Fma_RvtRvRvN_0(scalar_t* Rvt0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            natural_t N1 = 0;
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>)
+                for(; N1 + LOOP_OFFSET <= N0; N1 += LOOP_OFFSET) {
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Fma_RsRsRs_Rs(Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0), Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0), Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_0)));
+                    St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Fma_RsRsRs_Rs(Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1), Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1), Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_1)));
+                }
+            #endif
+
+            for(; N1 < N0; ++N1)
+                Rvt0[N1] += Rv0[N1] * Rv1[N1];
+        }
+
+
+        /**
+         * @brief Interleaved dot products, Rvt0[N2] = Σ Rv0[N3 * N1 + N2] * Rv1[N3 * N1 + N2], sequential.
+         * Chunk product of the (SELL-C-σ) layout, N1 being the chunk height, called within its parallel region.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], overwritten. Size: N1.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N0 Natural number [N], a multiple of N1.
+         * @param N1 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Dtc_RvtRvRvNN_0(scalar_t* Rvt0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0, const natural_t& N1) {
+            natural_t N2 = 0;
+
+            #ifdef _SIMD
+            if constexpr(std::is_same_v<scalar_t, real_t>)
+                for(; N2 + MEMORY_OFFSET <= N1; N2 += MEMORY_OFFSET) {
+                    reals_t Rs0 = Ex_R_Rs(0.0);
+
+                    for(natural_t N3 = N2; N3 < N0; N3 += N1)
+                        Rs0 = Fma_RsRsRs_Rs(Rs0, Ld_Rv_Rs(Rv0 + N3), Ld_Rv_Rs(Rv1 + N3));
+
+                    St_RvtRs_0(Rvt0 + N2, Rs0);
+                }
+            #endif
+
+            for(; N2 < N1; ++N2) {
+                scalar_t R0 = 0.0;
+
+                for(natural_t N3 = N2; N3 < N0; N3 += N1)
+                    R0 += Rv0[N3] * Rv1[N3];
+
+                Rvt0[N2] = R0;
+            }
+        }
+
+
+        /**
+         * @brief Dot products of a real_t* with N2 columns of a basis stored in N3 rotating columns (GEMV-T), Rvt0 = Q^T * Rv0.
+         * Rows are processed in blocks, every block of Rv0 being read once for all the columns.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], overwritten. Size: N2.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Dtb_RvtRmRvNNNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            for(natural_t N4 = 0; N4 < N2; ++N4)
+                Rvt0[N4] = 0.0;
+
+            #pragma omp parallel for reduction(+: Rvt0[:N2])
+            for(natural_t N4 = 0; N4 < N0; N4 += PROJECTION_BLOCK) {
+                const natural_t N5 = N0 - N4 < PROJECTION_BLOCK ? N0 : N4 + PROJECTION_BLOCK;
+
+                for(natural_t N6 = 0; N6 < N2; ++N6) {
+                    const scalar_t* Rv1 = Rm0 + ((N1 + N6) % N3) * N0;
+
+                    natural_t N7 = N4;
+                    scalar_t R0 = 0.0;
+
+                    #ifdef _SIMD
+                    if constexpr(std::is_same_v<scalar_t, real_t>) {
+                        reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
+
+                        for(; N7 + LOOP_OFFSET <= N5; N7 += LOOP_OFFSET) {
+                            Rs0 = Fma_RsRsRs_Rs(Rs0, Ld_Rv_Rs(Rv0 + N7 + MEMORY_OFFSET_0), Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_0));
+                            Rs1 = Fma_RsRsRs_Rs(Rs1, Ld_Rv_Rs(Rv0 + N7 + MEMORY_OFFSET_1), Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_1));
+                        }
+
+                        R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
+                    }
+                    #endif
+
+                    for(; N7 < N5; ++N7)
+                        R0 += Rv0[N7] * Rv1[N7];
+
+                    Rvt0[N6] += R0;
+                }
+            }
+        }
+
+
+        /**
+         * @brief Subtracts a combination of N2 columns of a basis stored in N3 rotating columns from a real_t* (GEMV), Rvt0 -= Q * Rv0.
+         * Rows are processed in blocks, every block of Rvt0 being read and written once for all the columns.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], not a column of the basis.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv], coefficients. Size: N2.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Prb_RvtRmRvNNNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N0; N4 += PROJECTION_BLOCK) {
+                const natural_t N5 = N0 - N4 < PROJECTION_BLOCK ? N0 : N4 + PROJECTION_BLOCK;
+
+                for(natural_t N6 = 0; N6 < N2; ++N6) {
+                    const scalar_t* Rv1 = Rm0 + ((N1 + N6) % N3) * N0;
+                    const scalar_t R0 = Rv0[N6];
+
+                    natural_t N7 = N4;
+
+                    #ifdef _SIMD
+                    if constexpr(std::is_same_v<scalar_t, real_t>) {
+                        const reals_t Rs0 = Ex_R_Rs(R0);
+
+                        for(; N7 + LOOP_OFFSET <= N5; N7 += LOOP_OFFSET) {
+                            St_RvtRs_0(Rvt0 + N7 + MEMORY_OFFSET_0, Fms_RsRsRs_Rs(Ld_Rv_Rs(Rvt0 + N7 + MEMORY_OFFSET_0), Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_0), Rs0));
+                            St_RvtRs_0(Rvt0 + N7 + MEMORY_OFFSET_1, Fms_RsRsRs_Rs(Ld_Rv_Rs(Rvt0 + N7 + MEMORY_OFFSET_1), Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_1), Rs0));
+                        }
+                    }
+                    #endif
+
+                    for(; N7 < N5; ++N7)
+                        Rvt0[N7] -= R0 * Rv1[N7];
+                }
+            }
+        }
+
+
+        /**
+         * @brief Dot products of two real_t* with N2 columns of a basis stored in N3 rotating columns, and with the first real_t*, in a single reduction.
+         * Rvt0 = [Q^T * Rv0, Q^T * Rv1, Rv0^T * Rv0, Rv0^T * Rv1], rows being processed in blocks as in Dtb_RvtRmRvNNNN_0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], overwritten. Size: 2 * N2 + 2.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv], may alias Rv0.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Dtl_RvtRmRvRvNNNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            for(natural_t N4 = 0; N4 < 2 * N2 + 2; ++N4)
+                Rvt0[N4] = 0.0;
+
+            #pragma omp parallel for reduction(+: Rvt0[:2 * N2 + 2])
+            for(natural_t N4 = 0; N4 < N0; N4 += PROJECTION_BLOCK) {
+                const natural_t N5 = N0 - N4 < PROJECTION_BLOCK ? N0 : N4 + PROJECTION_BLOCK;
+
+                // Columns, then Rv0 itself.
+                for(natural_t N6 = 0; N6 <= N2; ++N6) {
+                    const scalar_t* Rv2 = N6 < N2 ? Rm0 + ((N1 + N6) % N3) * N0 : Rv0;
+
+                    natural_t N7 = N4;
+                    scalar_t R0 = 0.0, R1 = 0.0;
+
+                    #ifdef _SIMD
+                    if constexpr(std::is_same_v<scalar_t, real_t>) {
+                        reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
+                        reals_t Rs2 = Ex_R_Rs(0.0), Rs3 = Ex_R_Rs(0.0);
+
+                        for(; N7 + LOOP_OFFSET <= N5; N7 += LOOP_OFFSET) {
+                            const reals_t Rs20 = Ld_Rv_Rs(Rv2 + N7 + MEMORY_OFFSET_0);
+                            const reals_t Rs21 = Ld_Rv_Rs(Rv2 + N7 + MEMORY_OFFSET_1);
+
+                            Rs0 = Fma_RsRsRs_Rs(Rs0, Ld_Rv_Rs(Rv0 + N7 + MEMORY_OFFSET_0), Rs20);
+                            Rs1 = Fma_RsRsRs_Rs(Rs1, Ld_Rv_Rs(Rv0 + N7 + MEMORY_OFFSET_1), Rs21);
+                            Rs2 = Fma_RsRsRs_Rs(Rs2, Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_0), Rs20);
+                            Rs3 = Fma_RsRsRs_Rs(Rs3, Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_1), Rs21);
+                        }
+
+                        R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
+                        R1 = Rd_Rs_R(Rs2) + Rd_Rs_R(Rs3);
+                    }
+                    #endif
+
+                    for(; N7 < N5; ++N7) {
+                        R0 += Rv0[N7] * Rv2[N7];
+                        R1 += Rv1[N7] * Rv2[N7];
+                    }
+
+                    Rvt0[N6 < N2 ? N6 : 2 * N2] += R0;
+                    Rvt0[N6 < N2 ? N2 + N6 : 2 * N2 + 1] += R1;
+                }
+            }
+        }
+
+
+        /**
+         * @brief Lagged update of two real_t* from the coefficients of Dtl_RvtRmRvRvNNNN_0, in a single pass without reductions.
+         * Rvt0 = (Rvt0 - Q * s) / R0 and, when given, Rvt1 = (Rvt1 - Q * z - R1 * Rvt0) / R0, s and z being the first and second halves of Rv0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], not a column of the basis.
+         * @param Rvt1 Real vector [Rv], target [t], not a column of the basis, possibly nullptr.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv], coefficients. Size: 2 * N2.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @param R0 Real number [R], norm.
+         * @param R1 Real number [R], projection on the updated Rvt0.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Prl_RvtRvtRmRvNNNNRR_0(scalar_t* Rvt0, scalar_t* Rvt1, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3, const scalar_t& R0, const scalar_t& R1) {
+            const scalar_t R2 = 1.0 / R0;
+
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N0; N4 += PROJECTION_BLOCK) {
+                const natural_t N5 = N0 - N4 < PROJECTION_BLOCK ? N0 : N4 + PROJECTION_BLOCK;
+
+                // Projections, the second target's on its own block pass.
+                for(natural_t N6 = 0; N6 < (Rvt1 ? 2 * N2 : N2); ++N6) {
+                    const scalar_t* Rv1 = Rm0 + ((N1 + N6 % N2) % N3) * N0;
+                    scalar_t* Rv2 = N6 < N2 ? Rvt0 : Rvt1;
+                    const scalar_t R3 = Rv0[N6];
+
+                    natural_t N7 = N4;
+
+                    #ifdef _SIMD
+                    if constexpr(std::is_same_v<scalar_t, real_t>) {
+                        const reals_t Rs0 = Ex_R_Rs(R3);
+
+                        for(; N7 + LOOP_OFFSET <= N5; N7 += LOOP_OFFSET) {
+                            St_RvtRs_0(Rv2 + N7 + MEMORY_OFFSET_0, Fms_RsRsRs_Rs(Ld_Rv_Rs(Rv2 + N7 + MEMORY_OFFSET_0), Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_0), Rs0));
+                            St_RvtRs_0(Rv2 + N7 + MEMORY_OFFSET_1, Fms_RsRsRs_Rs(Ld_Rv_Rs(Rv2 + N7 + MEMORY_OFFSET_1), Ld_Rv_Rs(Rv1 + N7 + MEMORY_OFFSET_1), Rs0));
+                        }
+                    }
+                    #endif
+
+                    for(; N7 < N5; ++N7)
+                        Rv2[N7] -= R3 * Rv1[N7];
+                }
+
+                // Normalization.
+                for(natural_t N6 = N4; N6 < N5; ++N6)
+                    Rvt0[N6] *= R2;
+
+                if(Rvt1)
+                    for(natural_t N6 = N4; N6 < N5; ++N6)
+                        Rvt1[N6] = (Rvt1[N6] - R1 * Rvt0[N6]) * R2;
+            }
+        }
+
+
+        // Tables.
+
+        #define KERNELS_INSTANTIATE(scalar_t, N) \
+            const vectors_t<scalar_t> KERNELS_TABLE(KERNELS_LEVEL, N) = { \
+                isa_t::KERNELS_LEVEL, \
+                Cp_RvtRvN_0<scalar_t>, \
+                Dt_RvRvN_R<scalar_t>, NPDt_RvRvN_R<scalar_t>, \
+                Nr_RvN_R<scalar_t>, Nrz_RvtN_0<scalar_t>, \
+                NPNr_RvN_R<scalar_t>, NPNrz_RvtN_0<scalar_t>, \
+                Prj_RvtRvRvN_R<scalar_t>, \
+                Dtb_RvtRmRvNNNN_0<scalar_t>, Prb_RvtRmRvNNNN_0<scalar_t>, \
+                Dtl_RvtRmRvRvNNNN_0<scalar_t>, Prl_RvtRvtRmRvNNNNRR_0<scalar_t>, \
+                Axm_RvtRRvN_0<scalar_t>, Fma_RvtRvRvN_0<scalar_t>, Dtc_RvtRvRvNN_0<scalar_t> \
+            };
+
+        KERNELS_INSTANTIATE(double, 64)
+        KERNELS_INSTANTIATE(float, 32)
+
+        #undef KERNELS_INSTANTIATE
+
+    }
+}
@@ -13,6 +13,7 @@
 #include <print>
 
 #include <cmath>
+#include <random>
 #define _USE_MATH_DEFINES
 
 #include "../include/Reals.hpp"
@@ -29,12 +30,14 @@ namespace nass {
          * @param Rv0 Real vector [Rv].
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Ml_RvtRmRvNN_0(real_t* Rvt0, const real_t* Rm0, const real_t* Rv0, const natural_t& N0, const natural_t& N1) {
+        template<typename scalar_t>
+        void Ml_RvtRmRvNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1) {
             #pragma omp parallel
             {
                 for(natural_t N2 = 0; N2 < N1; ++N2) {
-                    const real_t R0 = Rv0[N2];
+                    const scalar_t R0 = Rv0[N2];
 
                     #pragma omp for
                     for(natural_t N3 = 0; N3 < N0; ++N3)
@@ -53,8 +56,10 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Ml_RmtTRmRmNNN_0(real_t* Rmt0, const real_t* TRm0, const real_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+        template<typename scalar_t>
+        void Ml_RmtTRmRmNNN_0(scalar_t* Rmt0, const scalar_t* TRm0, const scalar_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
             for(natural_t N3 = 0; N3 < N2; ++N3)
                 for(natural_t N4 = 0; N4 < N1; ++N4)
                     for(natural_t N5 = 0; N5 < N0; ++N5)
@@ -71,8 +76,10 @@ namespace nass {
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Ml_RmtRmRmNNN_0(real_t* Rmt0, const real_t* Rm0, const real_t* Rm1, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+        template<typename scalar_t>
+        void Ml_RmtRmRmNNN_0(scalar_t* Rmt0, const scalar_t* Rm0, const scalar_t* Rm1, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
             for(natural_t N3 = 0; N3 < N2; ++N3)
                 for(natural_t N4 = 0; N4 < N1; ++N4)
                     for(natural_t N5 = 0; N5 < N0; ++N5)
@@ -81,21 +88,24 @@ namespace nass {
 
 
         /**
-         * @brief Gauss embedding.
+         * @brief Gauss embedding, drawn serially from a generator seeded with N2, so that equal seeds give equal embeddings.
          * 
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
+         * @param N2 Natural number [N], seed.
+         * @tparam scalar_t Scalar type.
          */
-        [[nodiscard]] real_t* Gs_NN_Rm(const natural_t& N0, const natural_t& N1) {
-            std::srand(std::time(nullptr));
+        template<typename scalar_t>
+        [[nodiscard]] scalar_t* Gs_NNN_Rm(const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+            std::mt19937 G0(static_cast<std::mt19937::result_type>(N2));
+            std::uniform_real_distribution<scalar_t> D0(0.0, 1.0);
 
-            real_t* Rm0 = new real_t[N0 * N1];
+            scalar_t* Rm0 = new scalar_t[N0 * N1];
 
-            #pragma omp parallel for
-            for(natural_t N2 = 0; N2 < N0 * N1; ++N2) {
-                const real_t R0 = static_cast<real_t>(std::rand()) / RAND_MAX;
+            for(natural_t N3 = 0; N3 < N0 * N1; ++N3) {
+                const scalar_t R0 = 1.0 - D0(G0);
 
-                Rm0[N2] = std::sqrt(-2.0 * std::log(R0)) * std::cos(2.0 * M_PI * R0);
+                Rm0[N3] = std::sqrt(-2.0 * std::log(R0)) * std::cos(2.0 * M_PI * R0);
             }
 
             return Rm0;
@@ -108,19 +118,36 @@ namespace nass {
          * @param Rm0 Real matrix [Rm].
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Pr_RmNN_0(const real_t* Rm0, const natural_t& N0, const natural_t& N1) {
+        template<typename scalar_t>
+        void Pr_RmNN_0(const scalar_t* Rm0, const natural_t& N0, const natural_t& N1) {
             std::println("--- Matrix.");
 
             for(natural_t N2 = 0; N2 < N0; ++N2) {
                 for(natural_t N3 = 0; N3 < N1 - 1; ++N3)
-                    Pr_R_0(Rm0[N3 * N0 + N2]);
+                    Pr_R_0(static_cast<real_t>(Rm0[N3 * N0 + N2]));
                 
-                Pn_R_0(Rm0[(N1 - 1) * N0 + N2]);
+                Pn_R_0(static_cast<real_t>(Rm0[(N1 - 1) * N0 + N2]));
             }
 
             std::println("---");
         }
 
+
+        // Instantiations.
+
+        #define NASS_MATRIX_INSTANTIATE(scalar_t) \
+            template void Ml_RvtRmRvNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&); \
+            template void Ml_RmtTRmRmNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&); \
+            template void Ml_RmtRmRmNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&); \
+            template scalar_t* Gs_NNN_Rm<scalar_t>(const natural_t&, const natural_t&, const natural_t&); \
+            template void Pr_RmNN_0(const scalar_t*, const natural_t&, const natural_t&);
+
+        NASS_MATRIX_INSTANTIATE(double)
+        NASS_MATRIX_INSTANTIATE(float)
+
+        #undef NASS_MATRIX_INSTANTIATE
+
     }
 }
\ No newline at end of file
@@ -0,0 +1,275 @@
+/**
+ * @file NASS_Numa.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Numa.hpp implementations.
+ * @date 2024-12-19
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <utility>
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "../include/Numa.hpp"
+
+// Placement report: sampled pages per array.
+#define PLACEMENT_SAMPLES 4096
+
+namespace nass {
+    namespace internal {
+
+        /**
+         * @brief Number of NUMA nodes, one when unknown.
+         * 
+         * @return natural_t Natural number [N].
+         */
+        [[nodiscard]] natural_t Nds_0_N() {
+            std::error_code E0;
+            natural_t N0 = 0;
+
+            for(const auto& D0: std::filesystem::directory_iterator("/sys/devices/system/node", E0)) {
+                const std::string St0 = D0.path().filename().string();
+
+                if(St0.starts_with("node") && St0.size() > 4 && std::isdigit(static_cast<unsigned char>(St0[4])))
+                    ++N0;
+            }
+
+            return std::max<natural_t>(N0, 1);
+        }
+
+
+        /**
+         * @brief NUMA node of a CPU, zero when unknown.
+         * 
+         * @param N0 Natural number [N], CPU.
+         * @return natural_t Natural number [N].
+         */
+        [[nodiscard]] static natural_t Nd_N_N(const natural_t& N0) {
+            std::error_code E0;
+
+            for(const auto& D0: std::filesystem::directory_iterator("/sys/devices/system/cpu/cpu" + std::to_string(N0), E0)) {
+                const std::string St0 = D0.path().filename().string();
+
+                if(St0.starts_with("node") && St0.size() > 4 && std::isdigit(static_cast<unsigned char>(St0[4])))
+                    return std::stoul(St0.substr(4));
+            }
+
+            return 0;
+        }
+
+
+        /**
+         * @brief Pins every OpenMP thread to a CPU of the process, spreading threads evenly over the NUMA nodes.
+         * Does nothing when the OpenMP runtime already binds threads, see OMP_PROC_BIND.
+         * 
+         * @return bool Boolean [B], pinned.
+         */
+        [[nodiscard]] bool Pin_0_B() {
+            #ifdef _OPENMP
+            if(omp_get_proc_bind() != omp_proc_bind_false)
+                return false;
+
+            cpu_set_t S0;
+            CPU_ZERO(&S0);
+
+            if(sched_getaffinity(0, sizeof(cpu_set_t), &S0) != 0)
+                return false;
+
+            // CPUs, by node.
+            std::vector<std::pair<natural_t, natural_t>> Pv0;
+
+            for(natural_t N0 = 0; N0 < CPU_SETSIZE; ++N0)
+                if(CPU_ISSET(N0, &S0))
+                    Pv0.emplace_back(Nd_N_N(N0), N0);
+
+            std::sort(Pv0.begin(), Pv0.end());
+
+            bool B0 = true;
+
+            #pragma omp parallel reduction(&&: B0)
+            {
+                const natural_t N0 = static_cast<natural_t>(omp_get_num_threads());
+                const natural_t N1 = static_cast<natural_t>(omp_get_thread_num());
+
+                cpu_set_t S1;
+                CPU_ZERO(&S1);
+                CPU_SET(Pv0[N1 * Pv0.size() / N0].second, &S1);
+
+                B0 = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &S1) == 0;
+            }
+
+            return B0;
+            #else
+            return false;
+            #endif
+        }
+
+
+        /**
+         * @brief Allocates a zeroed real matrix, first touched with the row partitioning of the parallel vector loops.
+         * 
+         * @param N0 Natural number [N], rows.
+         * @param N1 Natural number [N], columns.
+         * @tparam value_t Value type.
+         * @return value_t* Real matrix [Rm]. Size: N0 x N1.
+         */
+        template<typename value_t>
+        [[nodiscard]] value_t* Ftz_NN_Rm(const natural_t& N0, const natural_t& N1) {
+            value_t* Rm0 = new value_t[N0 * N1];
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N0; ++N2)
+                for(natural_t N3 = 0; N3 < N1; ++N3)
+                    Rm0[N3 * N0 + N2] = 0;
+
+            return Rm0;
+        }
+
+
+        /**
+         * @brief Copies a (CSC) sparse matrix into first-touched arrays.
+         * Columns are split among N1 threads balancing their entries, as the row splitting of Spl_NNvNv_NNvNv does, and every thread touches its own columns.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param N1 Natural number [N], threads.
+         * @tparam index_t Index type.
+         * @return std::tuple<index_t*, index_t*, real_t*> (CSC) sparse matrix [Spc].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<index_t*, index_t*, real_t*> Ftc_NNvNvRvN_NvNvRv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const natural_t& N1) {
+            const natural_t N2 = Nv0[N0];
+
+            index_t* Nv2 = new index_t[N0 + 1];
+            index_t* Nv3 = new index_t[N2];
+            real_t* Rv1 = new real_t[N2];
+
+            #pragma omp parallel for schedule(static, 1) num_threads(N1)
+            for(natural_t N3 = 0; N3 < N1; ++N3) {
+                const natural_t N4 = std::upper_bound(Nv0, Nv0 + N0 + 1, static_cast<index_t>(N2 * N3 / N1)) - Nv0 - 1;
+                const natural_t N5 = N3 + 1 == N1 ? N0 : std::upper_bound(Nv0, Nv0 + N0 + 1, static_cast<index_t>(N2 * (N3 + 1) / N1)) - Nv0 - 1;
+
+                std::copy(Nv0 + N4 + (N3 > 0), Nv0 + N5 + 1, Nv2 + N4 + (N3 > 0));
+                std::copy(Nv1 + Nv0[N4], Nv1 + Nv0[N5], Nv3 + Nv0[N4]);
+                std::copy(Rv0 + Nv0[N4], Rv0 + Nv0[N5], Rv1 + Nv0[N4]);
+            }
+
+            return {Nv2, Nv3, Rv1};
+        }
+
+
+        /**
+         * @brief NUMA node of every OpenMP thread, as currently scheduled.
+         * 
+         * @return std::vector<natural_t> Natural vector [Nv].
+         */
+        [[nodiscard]] std::vector<natural_t> Thr_0_Nv() {
+            #ifdef _OPENMP
+            std::vector<natural_t> Nv0(omp_get_max_threads(), 0);
+            #else
+            std::vector<natural_t> Nv0(1, 0);
+            #endif
+
+            #pragma omp parallel
+            {
+                unsigned int I0 = 0, I1 = 0;
+
+                #ifdef _OPENMP
+                const natural_t N0 = static_cast<natural_t>(omp_get_thread_num());
+                #else
+                const natural_t N0 = 0;
+                #endif
+
+                if(syscall(SYS_getcpu, &I0, &I1, nullptr) == 0)
+                    Nv0[N0] = I1;
+            }
+
+            return Nv0;
+        }
+
+
+        /**
+         * @brief Pages of an array per NUMA node, sampled.
+         * The last entry counts the pages not yet placed or not queried.
+         * 
+         * @param V0 Array.
+         * @param N0 Natural number [N], bytes.
+         * @return std::vector<natural_t> Natural vector [Nv], pages per node.
+         */
+        [[nodiscard]] std::vector<natural_t> Plc_CvN_Nv(const void* V0, const natural_t& N0) {
+            const natural_t N1 = Nds_0_N();
+            std::vector<natural_t> Nv0(N1 + 1, 0);
+
+            if(V0 == nullptr || N0 == 0)
+                return Nv0;
+
+            const natural_t N2 = static_cast<natural_t>(sysconf(_SC_PAGESIZE));
+            const std::uintptr_t N3 = reinterpret_cast<std::uintptr_t>(V0) / N2 * N2;
+            const natural_t N4 = (reinterpret_cast<std::uintptr_t>(V0) + N0 - N3 + N2 - 1) / N2;
+            const natural_t N5 = std::min<natural_t>(N4, PLACEMENT_SAMPLES);
+
+            std::vector<void*> Vv0(N5);
+            std::vector<int> Iv0(N5, -1);
+
+            for(natural_t N6 = 0; N6 < N5; ++N6)
+                Vv0[N6] = reinterpret_cast<void*>(N3 + N6 * N4 / N5 * N2);
+
+            // Query only, no pages are moved.
+            if(syscall(SYS_move_pages, 0, N5, Vv0.data(), nullptr, Iv0.data(), 0) != 0)
+                std::fill(Iv0.begin(), Iv0.end(), -1);
+
+            for(const int& I0: Iv0)
+                ++Nv0[I0 >= 0 && static_cast<natural_t>(I0) < N1 ? I0 : N1];
+
+            return Nv0;
+        }
+
+
+        /**
+         * @brief Whether the pages of an array are local to every OpenMP thread.
+         * Always on a single node, otherwise every sampled page must be placed on the node running all the threads.
+         * 
+         * @param V0 Array.
+         * @param N0 Natural number [N], bytes.
+         * @return bool Boolean [B].
+         */
+        [[nodiscard]] bool Lcl_CvN_B(const void* V0, const natural_t& N0) {
+            const natural_t N1 = Nds_0_N();
+
+            if(N1 == 1)
+                return true;
+
+            const std::vector<natural_t> Nv0 = Thr_0_Nv();
+            const std::vector<natural_t> Nv1 = Plc_CvN_Nv(V0, N0);
+
+            // Threads on a single node.
+            for(const natural_t& N2: Nv0)
+                if(N2 != Nv0[0])
+                    return false;
+
+            // Every sampled page on it, none unplaced.
+            return Nv0[0] < N1 && Nv1[Nv0[0]] == std::accumulate(Nv1.begin(), Nv1.end(), static_cast<natural_t>(0));
+        }
+
+
+        // Instantiations.
+
+        template double* Ftz_NN_Rm(const natural_t&, const natural_t&);
+        template float* Ftz_NN_Rm(const natural_t&, const natural_t&);
+
+        template std::tuple<natural_t*, natural_t*, real_t*> Ftc_NNvNvRvN_NvNvRv(const natural_t&, const natural_t*, const natural_t*, const real_t*, const natural_t&);
+        template std::tuple<natural32_t*, natural32_t*, real_t*> Ftc_NNvNvRvN_NvNvRv(const natural_t&, const natural32_t*, const natural32_t*, const real_t*, const natural_t&);
+
+    }
+}
@@ -20,6 +20,17 @@
 #error "Unsafe constant definition."
 #endif
 
+#if defined(LOW_SYNC) && defined(MATRIX_POWERS)
+#error "Unsafe constant definition."
+#endif
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <span>
+#include <type_traits>
+#define _USE_MATH_DEFINES
+
 #ifndef NVERBOSE
 #include <chrono>
 #endif
@@ -32,29 +43,346 @@
 #include "../include/Matrix.hpp"
 #include "../include/Sparse.hpp"
 #include "../include/Decomposition.hpp"
+#include "../include/Numa.hpp"
 #include "../include/Solver.hpp"
 
 namespace nass {
     namespace internal {
 
+        #ifndef NVERBOSE
+        natural_t orthogonalization_reductions = 0;
+        #endif
+
+
         /**
-         * @brief Sketched GMRES.
+         * @brief Truncated (re-)orthogonalization and normalization of a basis column, accumulating the projection coefficients.
+         * The basis is stored in N3 rotating columns, column N1 is orthogonalized against the previous N2 ones.
+         * Block classical Gram-Schmidt, twice: each sweep computes all the coefficients in one pass and subtracts their combination in another.
+         *
+         * @param Rmt0 Real matrix [Rm], target [t], basis.
+         * @param Rvt0 Real vector [Rv], target [t], coefficients, by column.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], column.
+         * @param N2 Natural number [N], truncation.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         * @return scalar_t Real number [R], norm before normalization.
+         */
+        template<typename scalar_t>
+        scalar_t Ort_RmtRvtNNNN_R(scalar_t* Rmt0, scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            const natural_t N4 = N1 > N2 ? N1 - N2 : 0;
+            const natural_t N5 = N1 - N4;
+            scalar_t* Rv0 = Rmt0 + (N1 % N3) * N0;
+
+            if(N5 > 0) {
+                scalar_t* Rv1 = new scalar_t[N5];
+
+                // Orthogonalization, coefficients and combination.
+                Dtb_RvtRmRvNNNN_0(Rvt0 + N4, Rmt0, Rv0, N0, N4 % N3, N5, N3);
+                Prb_RvtRmRvNNNN_0(Rv0, Rmt0, Rvt0 + N4, N0, N4 % N3, N5, N3);
+
+                // Re-orthogonalization.
+                Dtb_RvtRmRvNNNN_0(Rv1, Rmt0, Rv0, N0, N4 % N3, N5, N3);
+                Prb_RvtRmRvNNNN_0(Rv0, Rmt0, Rv1, N0, N4 % N3, N5, N3);
+
+                for(natural_t N6 = 0; N6 < N5; ++N6)
+                    Rvt0[N4 + N6] += Rv1[N6];
+
+                delete[] Rv1;
+
+                #ifndef NVERBOSE
+                orthogonalization_reductions += 2;
+                #endif
+            }
+
+            // Normalization.
+            const scalar_t R0 = Nr_RvN_R(Rv0, N0);
+
+            #ifndef NVERBOSE
+            ++orthogonalization_reductions;
+            #endif
+
+            #pragma omp parallel for
+            for(natural_t N6 = 0; N6 < N0; ++N6)
+                Rv0[N6] /= R0;
+
+            return R0;
+        }
+
+
+        /**
+         * @brief Lagged truncated re-orthogonalization and normalization of a basis column, and orthogonalization of the next one, in a single reduction.
+         * Delayed classical Gram-Schmidt, twice: column N1 was orthogonalized once by the previous call, column N1 + 1, when B0, holds its product.
+         * Column N1 is re-orthogonalized against the previous N2 ones and normalized by its lagged (Pythagorean) norm, column N1 + 1 is orthogonalized once against the N2 columns ending at column N1 and scaled by the same norm.
+         * When the Pythagorean difference cancels, at most epsilon times the squared norm, column N1 is re-orthogonalized first and its norm, and projection, are taken explicitly.
+         *
+         * @param Rmt0 Real matrix [Rm], target [t], basis.
+         * @param Rvt0 Real vector [Rv], target [t], re-orthogonalization coefficients of column N1, by column.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], column.
+         * @param N2 Natural number [N], truncation.
+         * @param N3 Natural number [N], rotating columns.
+         * @param B0 Boolean [B], next column.
+         * @tparam scalar_t Scalar type.
+         * @return scalar_t Real number [R], norm before normalization.
+         */
+        template<typename scalar_t>
+        scalar_t Lso_RmtRvtNNNNB_R(scalar_t* Rmt0, scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3, const bool& B0) {
+            const natural_t N4 = N1 > N2 ? N1 - N2 : 0;
+            const natural_t N5 = N1 - N4;
+
+            #ifndef NDEBUG // Integrity check.
+            assert(N5 + (B0 ? 2 : 1) <= N3);
+            #endif
+
+            scalar_t* Rv0 = Rmt0 + (N1 % N3) * N0;
+            scalar_t* Rv1 = B0 ? Rmt0 + ((N1 + 1) % N3) * N0 : nullptr;
+            scalar_t* Rv2 = new scalar_t[2 * N5 + 2];
+
+            // Coefficients, norm and projection, single reduction.
+            Dtl_RvtRmRvRvNNNN_0(Rv2, Rmt0, Rv0, B0 ? Rv1 : Rv0, N0, N4 % N3, N5, N3);
+
+            #ifndef NVERBOSE
+            ++orthogonalization_reductions;
+            #endif
+
+            scalar_t R0 = Rv2[2 * N5], R1 = Rv2[2 * N5 + 1];
+
+            for(natural_t N6 = 0; N6 < N5; ++N6) {
+                R0 -= Rv2[N6] * Rv2[N6];
+                R1 -= Rv2[N6] * Rv2[N5 + N6];
+
+                Rvt0[N4 + N6] = Rv2[N6];
+            }
+
+            // The first column falls out of the next column's window.
+            if(N1 >= N2)
+                Rv2[N5] = 0.0;
+
+            if(R0 > std::numeric_limits<scalar_t>::epsilon() * Rv2[2 * N5]) {
+                R0 = std::sqrt(R0);
+                R1 /= R0;
+            } else {
+
+                // Cancellation, explicit re-orthogonalization, norm and projection.
+                Prl_RvtRvtRmRvNNNNRR_0(Rv0, static_cast<scalar_t*>(nullptr), Rmt0, Rv2, N0, N4 % N3, N5, N3, static_cast<scalar_t>(1.0), static_cast<scalar_t>(0.0));
+
+                R0 = Nr_RvN_R(Rv0, N0);
+                R1 = B0 ? Dt_RvRvN_R(Rv0, Rv1, N0) / R0 : 0.0;
+
+                #ifndef NVERBOSE
+                orthogonalization_reductions += B0 ? 2 : 1;
+                #endif
+
+                for(natural_t N6 = 0; N6 < N5; ++N6)
+                    Rv2[N6] = 0.0;
+            }
+
+            // Re-orthogonalization, normalization and orthogonalization, single pass.
+            Prl_RvtRvtRmRvNNNNRR_0(Rv0, Rv1, Rmt0, Rv2, N0, N4 % N3, N5, N3, R0, R1);
+
+            delete[] Rv2;
+            return R0;
+        }
+
+
+        /**
+         * @brief Product of a basis column, from the product of the column it was orthogonalized from.
+         * A * v = (A * w - Σ c_i * A * v_i) / R0, v being w orthogonalized by Ort_RmtRvtNNNN_R, or re-orthogonalized by Lso_RmtRvtNNNNB_R; sketched products are recurred alike.
+         *
+         * @param Rmt0 Real matrix [Rm], target [t], products of the basis columns.
+         * @param Rv0 Real vector [Rv], A * w, may alias the target column.
+         * @param Rv1 Real vector [Rv], coefficients, from Ort_RmtRvtNNNN_R or Lso_RmtRvtNNNNB_R.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], column.
+         * @param N2 Natural number [N], truncation.
+         * @param R0 Real number [R], norm, from Ort_RmtRvtNNNN_R or Lso_RmtRvtNNNNB_R.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Rec_RmtRvRvNNNR_0(scalar_t* Rmt0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0, const natural_t& N1, const natural_t& N2, const scalar_t& R0) {
+            const natural_t N3 = N1 > N2 ? N1 - N2 : 0;
+
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N0; ++N4) {
+                scalar_t R2 = Rv0[N4];
+
+                for(natural_t N5 = N3; N5 < N1; ++N5)
+                    R2 -= Rv1[N5] * Rmt0[N5 * N0 + N4];
+
+                Rmt0[N1 * N0 + N4] = R2 / R0;
+            }
+        }
+
+
+        /**
+         * @brief Column of the Hessenberg matrix of the Arnoldi process, from the coefficients and the norm of the orthogonalization of a basis column.
+         *
+         * @param Rmt0 Real matrix [Rm], target [t], Hessenberg matrix. Size: N0 x N0, by column.
+         * @param Rv0 Real vector [Rv], coefficients, from Ort_RmtRvtNNNN_R.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], column, from 1 to N0, orthogonalized from the product of column N1 - 1.
+         * @param N2 Natural number [N], truncation.
+         * @param R0 Real number [R], norm, from Ort_RmtRvtNNNN_R.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Hs_RmtRvNNNR_0(scalar_t* Rmt0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const scalar_t& R0) {
+            for(natural_t N3 = N1 > N2 ? N1 - N2 : 0; N3 < N1; ++N3)
+                Rmt0[(N1 - 1) * N0 + N3] = Rv0[N3];
+
+            if(N1 < N0)
+                Rmt0[(N1 - 1) * N0 + N1] = R0;
+        }
+
+
+        /**
+         * @brief Shifts of the Newton basis, the real parts of the Ritz values of a Hessenberg matrix, in Leja order.
+         * Ritz values are the roots of det(z * I - H), found by Durand-Kerner iterations on the determinant, evaluated by Gaussian elimination; a conjugate pair gives its real part twice.
+         * The Leja order takes the largest shift first, then the farthest from the previous ones, so that consecutive factors of the basis do not amplify the same eigenvectors.
+         *
+         * @param Rvt0 Real vector [Rv], target [t], shifts.
+         * @param Rm0 Real matrix [Rm], Hessenberg matrix. Size: N0 x N0, by column.
+         * @param N0 Natural number [N], at most powers_steps.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Rtz_RvtRmN_0(scalar_t* Rvt0, const scalar_t* Rm0, const natural_t& N0) {
+            #ifndef NDEBUG // Integrity check.
+            assert(N0 <= powers_steps);
+            #endif
+
+            std::complex<real_t> Cm0[powers_steps * powers_steps], Cv0[powers_steps];
+            real_t Rv0[powers_steps] = {};
+
+            // Radius, bounding the spectrum.
+            real_t R0 = 0.0;
+
+            for(natural_t N1 = 0; N1 < N0 * N0; ++N1)
+                R0 = std::max(R0, static_cast<real_t>(std::abs(Rm0[N1])));
+
+            R0 = R0 > 0.0 ? N0 * R0 : 1.0;
+
+            // Starting points, off any symmetry of the spectrum.
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Cv0[N1] = std::polar(R0, 2.0 * M_PI * N1 / N0 + 0.4);
+
+            // Durand-Kerner iterations.
+            for(natural_t N1 = 0; N1 < 100; ++N1) {
+                real_t R1 = 0.0;
+
+                for(natural_t N2 = 0; N2 < N0; ++N2) {
+
+                    // det(z * I - H), Gaussian elimination with partial pivoting.
+                    for(natural_t N3 = 0; N3 < N0 * N0; ++N3)
+                        Cm0[N3] = -static_cast<real_t>(Rm0[N3]);
+
+                    for(natural_t N3 = 0; N3 < N0; ++N3)
+                        Cm0[N3 * (N0 + 1)] += Cv0[N2];
+
+                    std::complex<real_t> C0 = 1.0;
+
+                    for(natural_t N3 = 0; N3 < N0; ++N3) {
+                        natural_t N4 = N3;
+
+                        for(natural_t N5 = N3 + 1; N5 < N0; ++N5)
+                            if(std::abs(Cm0[N3 * N0 + N5]) > std::abs(Cm0[N3 * N0 + N4]))
+                                N4 = N5;
+
+                        if(N4 != N3) {
+                            for(natural_t N5 = N3; N5 < N0; ++N5)
+                                std::swap(Cm0[N5 * N0 + N3], Cm0[N5 * N0 + N4]);
+
+                            C0 = -C0;
+                        }
+
+                        C0 *= Cm0[N3 * (N0 + 1)];
+
+                        if(Cm0[N3 * (N0 + 1)] == 0.0)
+                            break;
+
+                        for(natural_t N5 = N3 + 1; N5 < N0; ++N5) {
+                            const std::complex<real_t> C1 = Cm0[N3 * N0 + N5] / Cm0[N3 * (N0 + 1)];
+
+                            for(natural_t N6 = N3 + 1; N6 < N0; ++N6)
+                                Cm0[N6 * N0 + N5] -= C1 * Cm0[N6 * N0 + N3];
+                        }
+                    }
+
+                    // Update.
+                    std::complex<real_t> C1 = 1.0;
+
+                    for(natural_t N3 = 0; N3 < N0; ++N3)
+                        if(N3 != N2)
+                            C1 *= Cv0[N2] - Cv0[N3];
+
+                    if(C1 != 0.0) {
+                        Cv0[N2] -= C0 / C1;
+                        R1 = std::max(R1, std::abs(C0 / C1));
+                    }
+                }
+
+                if(R1 <= std::numeric_limits<real_t>::epsilon() * R0)
+                    break;
+            }
+
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Rv0[N1] = std::isfinite(Cv0[N1].real()) ? Cv0[N1].real() : 0.0;
+
+            // Leja order.
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                natural_t N2 = N1;
+                real_t R1 = -1.0;
+
+                for(natural_t N3 = N1; N3 < N0; ++N3) {
+                    real_t R2 = std::abs(Rv0[N3]);
+
+                    if(N1 > 0) {
+                        R2 = 1.0;
+
+                        for(natural_t N4 = 0; N4 < N1; ++N4)
+                            R2 *= std::abs(Rv0[N3] - Rv0[N4]);
+                    }
+
+                    if(R2 > R1) {
+                        R1 = R2;
+                        N2 = N3;
+                    }
+                }
+
+                std::swap(Rv0[N1], Rv0[N2]);
+                Rvt0[N1] = static_cast<scalar_t>(Rv0[N1]);
+            }
+        }
+
+
+        /**
+         * @brief Sketched GMRES, fused operator and matrix powers.
+         * Under MEMORY_PRIORITY, Of0, when given, produces every LS column together with its sketch.
+         * Pw0, when given, generates the basis powers_steps columns per sweep (s-step Arnoldi): the first sweep runs on the plain operator, the Ritz values of its Hessenberg matrix shifting the Newton basis of the next ones, every column is orthogonalized from a basis vector and its LS column is recurred from the next one, scaled back and shifted.
+         * Under LOW_SYNC, the truncated Arnoldi is orthogonalized by Lso_RmtRvtNNNNB_R, a single reduction per column, every LS column being recurred from the product of its lagged column; Pw0 must be empty.
          *
          * @param Rvt0 Real vector [Rv], target [t].
          * @param N0 Natural number [N].
-         * @param Nv0 Natural vector [Nv].
-         * @param Nv1 Natural vector [Nv].
+         * @param Op0 Operator [Op].
+         * @param Of0 Fused operator [Of], possibly empty.
+         * @param Pw0 Matrix powers [Pw], possibly empty.
          * @param Rv0 Real vector [Rv].
-         * @param Rv1 Real vector [Rv].
          * @param N1 Natural number [N].
          * @param N2 Natural number [N].
-         * @return std::array<real_t, 2> Real numbers [R].
+         * @tparam scalar_t Scalar type.
+         * @return std::array<scalar_t, 2> Real numbers [R].
          */
-        std::array<real_t, 2> sGMRES_RvNNvNvRvRvNN_RR(real_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const real_t* Rv1, const natural_t& N1, const natural_t& N2) {
+        template<typename scalar_t>
+        std::array<scalar_t, 2> sGMRES_RvNOpOfPwRvNN_RR(scalar_t* Rvt0, const natural_t& N0, const operator_t<scalar_t>& Op0, const fused_t<scalar_t>& Of0, const powers_t<scalar_t>& Pw0, const scalar_t* Rv0, const natural_t& N1, const natural_t& N2) {
             #ifndef NDEBUG // Integrity check.
             assert(N1 > 0);
             assert(N2 > 0);
             assert(N2 <= N1);
+
+            #ifdef LOW_SYNC
+            assert(!Pw0);
+            #endif
             #endif
 
             #ifndef NVERBOSE
@@ -64,6 +392,14 @@ namespace nass {
             std::println("--- sGMRES, memory priority.");
             #endif
             std::println("Parameters: {}, {}, {}", N0, N1, N2);
+
+            if(Pw0)
+                std::println("Matrix powers: {}", powers_steps);
+
+            #ifdef LOW_SYNC
+            std::println("Orthogonalization: lagged, single reduction");
+            #endif
+
             std::println("Timings:");
             #endif
 
@@ -81,9 +417,9 @@ namespace nass {
 
 
             #if defined(SPARSE_SKETCH)
-            const auto [Nv2, Nv3, Rv2] = Sec_NN_NvNvRv(N1, N0);
+            const auto [Nv2, Nv3, Rv2] = Sec_NNN_NvNvRv<scalar_t>(N1, N0, sketch_seed);
             #elif defined(GAUSS_SKETCH)
-            real_t* Rm0 = Gs_NN_Rm(N3, N0);
+            scalar_t* Rm0 = Gs_NNN_Rm<scalar_t>(N3, N0, sketch_seed);
             #endif
 
 
@@ -100,32 +436,53 @@ namespace nass {
 
 
             #ifndef MEMORY_PRIORITY
-            real_t* Rm1 = new real_t[N0 * N1]; // Basis.
-            real_t* Rm2 = new real_t[N0 * N1]; // LS matrix.
+            scalar_t* Rm1 = Ftz_NN_Rm<scalar_t>(N0, N1); // Basis.
+            scalar_t* Rm2 = Ftz_NN_Rm<scalar_t>(N0, N1); // LS matrix.
+
+            #if defined(SPARSE_SKETCH)
+            std::vector<scalar_t> Rv14; // Sketch application, private copies and packed tiles.
+            #endif
             #else 
-            real_t* Rm1 = new real_t[N0 * (N2 + 1)]; // Partial basis.
+            #ifndef LOW_SYNC
+            scalar_t* Rm1 = Ftz_NN_Rm<scalar_t>(N0, N2 + 1); // Partial basis.
+            #else
+            scalar_t* Rm1 = Ftz_NN_Rm<scalar_t>(N0, N2 + 2); // Partial basis, and the product of its lagged column.
+            #endif
             #endif
 
             // Sketched LS matrix.
-            real_t* Rm3 = new real_t[N3 * N1];
+            scalar_t* Rm3 = new scalar_t[N3 * N1]();
 
             // QR.
-            real_t* Rm4 = new real_t[N3 * N1];
+            scalar_t* Rm4 = new scalar_t[N3 * N1];
             natural_t* Nv4 = new natural_t[N1];
 
             // Minimizer.
-            real_t* Rv3 = new real_t[N1];
+            scalar_t* Rv3 = new scalar_t[N1];
 
             // Residual and residual sketch.
-            real_t* Rv4 = new real_t[N0];
-            real_t* Rv5 = new real_t[N3];
+            scalar_t* Rv4 = Ftz_NN_Rm<scalar_t>(N0, 1);
+            scalar_t* Rv5 = new scalar_t[N3]();
 
             // LS solution and permuted version.
-            real_t* Rv6 = new real_t[N1];
-            real_t* Rv7 = new real_t[N1];
+            scalar_t* Rv6 = new scalar_t[N1];
+            scalar_t* Rv7 = new scalar_t[N1];
 
             // Residual estimates.
-            real_t* Rv8 = new real_t[N3];
+            scalar_t* Rv8 = new scalar_t[N3];
+
+            // Matrix powers and projection coefficients.
+            scalar_t* Rm5 = Pw0 ? Ftz_NN_Rm<scalar_t>(N0, powers_steps) : nullptr;
+            scalar_t* Rv9 = new scalar_t[N1];
+
+            // Hessenberg matrix of the first sweep and shifts of the Newton basis.
+            scalar_t* Rm6 = new scalar_t[powers_steps * powers_steps]();
+            scalar_t* Rv10 = new scalar_t[powers_steps]();
+
+            #ifdef MEMORY_PRIORITY
+            // Sketches of the Newton basis, alternating.
+            scalar_t* Rv11 = Pw0 ? new scalar_t[2 * N3] : nullptr;
+            #endif
 
 
             #ifndef NVERBOSE
@@ -138,7 +495,11 @@ namespace nass {
             // sGMRES.
 
             // Residual.
-            RMlc_RvtNNvNvRvRvRv_0(Rv4, N0, Nv0, Nv1, Rv0, Rvt0, Rv1);
+            Op0(Rv4, Rvt0);
+
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N0; ++N4)
+                Rv4[N4] = Rv0[N4] - Rv4[N4];
 
             // Residual sketch.
             #if defined(SPARSE_SKETCH)
@@ -163,94 +524,222 @@ namespace nass {
 
             #ifndef MEMORY_PRIORITY
 
-            // First LS column.
-            Mlc_RvtNNvNvRvRv_0(Rm2, N0, Nv0, Nv1, Rv0, Rm1);
+            #ifndef LOW_SYNC
 
-            // Truncated Arnoldi, first part.
-            for(natural_t N4 = 1; N4 <= N2; ++N4) {
+            if(Pw0) {
+                const natural_t N7 = std::min(powers_steps, N1 - 1);
 
-                // Copy.
-                Cp_RvtRvN_0(Rm1 + N4 * N0, Rm2 + (N4 - 1) * N0, N0);
+                // Arnoldi, first sweep, by the plain operator.
+                for(natural_t N4 = 1; N4 <= N7; ++N4) {
 
-                // (Re-)orthogonalization.
-                for(natural_t N5 = 0; N5 < 2; ++N5)
-                    for(natural_t N6 = 0; N6 < N4; ++N6)
-                        Prj_RvtRvRvN_0(Rm1 + N4 * N0, Rm1 + N6 * N0, Rm1 + N4 * N0, N0);
+                    // LS column and copy.
+                    Op0(Rm2 + (N4 - 1) * N0, Rm1 + (N4 - 1) * N0);
+                    Cp_RvtRvN_0(Rm1 + N4 * N0, Rm2 + (N4 - 1) * N0, N0);
 
-                // Normalization.
-                Nrz_RvtN_0(Rm1 + N4 * N0, N0);
+                    // (Re-)orthogonalization and normalization, and Hessenberg matrix.
+                    const scalar_t R3 = Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N1);
+                    Hs_RmtRvNNNR_0(Rm6, Rv9, N7, N4, N2, R3);
+                }
 
-                // LS matrix.
-                Mlc_RvtNNvNvRvRv_0(Rm2 + N4 * N0, N0, Nv0, Nv1, Rv0, Rm1 + N4 * N0);
-            }
+                // Shifts of the next sweeps.
+                Rtz_RvtRmN_0(Rv10, Rm6, N7);
+
+                // s-step Arnoldi.
+                for(natural_t N4 = N7; N4 + 1 < N1; N4 += powers_steps) {
+                    const natural_t N5 = std::min(powers_steps, N1 - N4 - 1);
+
+                    // Scaled Newton basis, A * p_j = R4 * p_(j + 1) + θ_j * p_j being the LS column of the sweep's first column.
+                    const scalar_t R4 = Pw0(Rm5, Rm1 + N4 * N0, Rv10, N5);
 
-            // Truncated Arnoldi, second part.
-            for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
+                    #pragma omp parallel for
+                    for(natural_t N6 = 0; N6 < N0; ++N6)
+                        Rm2[N4 * N0 + N6] = R4 * Rm5[N6] + Rv10[0] * Rm1[N4 * N0 + N6];
 
-                // Copy.
-                Cp_RvtRvN_0(Rm1 + N4 * N0, Rm2 + (N4 - 1) * N0, N0);
+                    for(natural_t N6 = 1; N6 <= N5; ++N6) {
+
+                        // Copy, (re-)orthogonalization and normalization.
+                        Cp_RvtRvN_0(Rm1 + (N4 + N6) * N0, Rm5 + (N6 - 1) * N0, N0);
+                        const scalar_t R3 = Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4 + N6, N2, N1);
+
+                        // LS matrix, recurred in place, the sweep's last column is multiplied by the next sweep.
+                        if(N6 < N5) {
+                            #pragma omp parallel for
+                            for(natural_t N8 = 0; N8 < N0; ++N8)
+                                Rm2[(N4 + N6) * N0 + N8] = R4 * Rm5[N6 * N0 + N8] + Rv10[N6] * Rm5[(N6 - 1) * N0 + N8];
+
+                            Rec_RmtRvRvNNNR_0(Rm2, Rm2 + (N4 + N6) * N0, Rv9, N0, N4 + N6, N2, R3);
+                        }
+                    }
+                }
 
-                // (Re-)orthogonalization.
-                for(natural_t N5 = 0; N5 < 2; ++N5)
-                    for(natural_t N6 = N4 - N2; N6 < N4; ++N6)
-                        Prj_RvtRvRvN_0(Rm1 + N4 * N0, Rm1 + N6 * N0, Rm1 + N4 * N0, N0);
+                // Last LS column.
+                Op0(Rm2 + (N1 - 1) * N0, Rm1 + (N1 - 1) * N0);
+            } else {
 
-                // Normalization.
-                Nrz_RvtN_0(Rm1 + N4 * N0, N0);
+                // First LS column.
+                Op0(Rm2, Rm1);
 
-                // LS matrix.
-                Mlc_RvtNNvNvRvRv_0(Rm2 + N4 * N0, N0, Nv0, Nv1, Rv0, Rm1 + N4 * N0);
+                // Truncated Arnoldi, first part.
+                for(natural_t N4 = 1; N4 <= N2; ++N4) {
+
+                    // Copy.
+                    Cp_RvtRvN_0(Rm1 + N4 * N0, Rm2 + (N4 - 1) * N0, N0);
+
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N1);
+
+                    // LS matrix.
+                    Op0(Rm2 + N4 * N0, Rm1 + N4 * N0);
+                }
+
+                // Truncated Arnoldi, second part.
+                for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
+
+                    // Copy.
+                    Cp_RvtRvN_0(Rm1 + N4 * N0, Rm2 + (N4 - 1) * N0, N0);
+
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N1);
+
+                    // LS matrix.
+                    Op0(Rm2 + N4 * N0, Rm1 + N4 * N0);
+                }
             }
 
             #else
 
-            // Truncated Arnoldi and sketching, first part.
-            for(natural_t N4 = 1; N4 <= N2; ++N4) {
+            // Truncated Arnoldi, lagged: the LS column of every column is recurred from the product of its lagged version.
+            for(natural_t N4 = 0; N4 < N1; ++N4) {
 
-                // LS column.
-                Mlc_RvtNNvNvRvRv_0(Rm1 + N4 * N0, N0, Nv0, Nv1, Rv0, Rm1 + (N4 - 1) * N0);
+                // Product of the lagged column and copy.
+                Op0(Rm2 + N4 * N0, Rm1 + N4 * N0);
 
-                // Sketch application.
-                Mlc_RvtNNvNvRvRv_0(Rm3 + (N4 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + N4 * N0);
+                if(N4 + 1 < N1)
+                    Cp_RvtRvN_0(Rm1 + (N4 + 1) * N0, Rm2 + N4 * N0, N0);
 
-                // (Re-)orthogonalization.
-                for(natural_t N5 = 0; N5 < 2; ++N5)
-                    for(natural_t N6 = 0; N6 < N4; ++N6)
-                        Prj_RvtRvRvN_0(Rm1 + N4 * N0, Rm1 + N6 * N0, Rm1 + N4 * N0, N0);
+                // Lagged (re-)orthogonalization and normalization.
+                const scalar_t R3 = Lso_RmtRvtNNNNB_R(Rm1, Rv9, N0, N4, N2, N1, N4 + 1 < N1);
 
-                // Normalization.
-                Nrz_RvtN_0(Rm1 + N4 * N0, N0);
+                // LS matrix, recurred in place.
+                Rec_RmtRvRvNNNR_0(Rm2, Rm2 + N4 * N0, Rv9, N0, N4, N2, R3);
             }
 
-            // Truncated Arnoldi and sketching, second part.
-            for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
+            #endif
 
-                // Indices.
-                const natural_t N5 = N4 % (N2 + 1);
-                const natural_t N6 = (N4 - 1) % (N2 + 1);
+            #else
 
-                // Zeroing.
-                #pragma omp parallel for
-                for(natural_t N7 = 0; N7 < N0; ++N7)
-                    Rm1[N5 * N0 + N7] = 0.0;
+            #ifndef LOW_SYNC
+
+            if(Pw0) {
+                const natural_t N7 = std::min(powers_steps, N1 - 1);
+
+                // Arnoldi and sketching, first sweep, by the plain operator.
+                for(natural_t N4 = 1; N4 <= N7; ++N4) {
+
+                    // Indices.
+                    const natural_t N5 = N4 % (N2 + 1);
+                    const natural_t N6 = (N4 - 1) % (N2 + 1);
+
+                    // Zeroing.
+                    #pragma omp parallel for
+                    for(natural_t N8 = 0; N8 < N0; ++N8)
+                        Rm1[N5 * N0 + N8] = 0.0;
+
+                    // LS column and sketch application.
+                    if(Of0)
+                        Of0(Rm1 + N5 * N0, Rm3 + (N4 - 1) * N3, Rm1 + N6 * N0, N3, Nv2, Nv3, Rv2);
+                    else {
+                        Op0(Rm1 + N5 * N0, Rm1 + N6 * N0);
+                        Mlc_RvtNNvNvRvRv_0(Rm3 + (N4 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + N5 * N0);
+                    }
+
+                    // (Re-)orthogonalization and normalization, and Hessenberg matrix.
+                    const scalar_t R3 = Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N2 + 1);
+                    Hs_RmtRvNNNR_0(Rm6, Rv9, N7, N4, N2, R3);
+                }
+
+                // Shifts of the next sweeps.
+                Rtz_RvtRmN_0(Rv10, Rm6, N7);
+
+                // s-step Arnoldi and sketching.
+                for(natural_t N4 = N7; N4 + 1 < N1; N4 += powers_steps) {
+                    const natural_t N5 = std::min(powers_steps, N1 - N4 - 1);
+
+                    // Scaled Newton basis, A * p_j = R4 * p_(j + 1) + θ_j * p_j being the LS column of the sweep's first column, sketched.
+                    const scalar_t R4 = Pw0(Rm5, Rm1 + (N4 % (N2 + 1)) * N0, Rv10, N5);
+
+                    for(natural_t N6 = 0; N6 < 2 * N3; ++N6)
+                        Rv11[N6] = 0.0;
+
+                    Mlc_RvtNNvNvRvRv_0(Rv11, N0, Nv2, Nv3, Rv2, Rm1 + (N4 % (N2 + 1)) * N0);
+                    Mlc_RvtNNvNvRvRv_0(Rv11 + N3, N0, Nv2, Nv3, Rv2, Rm5);
+
+                    for(natural_t N6 = 0; N6 < N3; ++N6)
+                        Rm3[N4 * N3 + N6] = R4 * Rv11[N3 + N6] + Rv10[0] * Rv11[N6];
+
+                    for(natural_t N6 = 1; N6 <= N5; ++N6) {
+
+                        // Copy, (re-)orthogonalization and normalization.
+                        Cp_RvtRvN_0(Rm1 + ((N4 + N6) % (N2 + 1)) * N0, Rm5 + (N6 - 1) * N0, N0);
+                        const scalar_t R3 = Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4 + N6, N2, N2 + 1);
+
+                        // Sketched LS matrix, recurred in place, the sweep's last column is multiplied by the next sweep.
+                        if(N6 < N5) {
+                            const scalar_t* Rv12 = Rv11 + (N6 % 2) * N3;
+                            scalar_t* Rv13 = Rv11 + ((N6 + 1) % 2) * N3;
+
+                            for(natural_t N8 = 0; N8 < N3; ++N8)
+                                Rv13[N8] = 0.0;
+
+                            Mlc_RvtNNvNvRvRv_0(Rv13, N0, Nv2, Nv3, Rv2, Rm5 + N6 * N0);
+
+                            for(natural_t N8 = 0; N8 < N3; ++N8)
+                                Rm3[(N4 + N6) * N3 + N8] = R4 * Rv13[N8] + Rv10[N6] * Rv12[N8];
+
+                            Rec_RmtRvRvNNNR_0(Rm3, Rm3 + (N4 + N6) * N3, Rv9, N3, N4 + N6, N2, R3);
+                        }
+                    }
+                }
+            } else {
+
+                // Truncated Arnoldi and sketching, first part.
+                for(natural_t N4 = 1; N4 <= N2; ++N4) {
+
+                    // LS column and sketch application.
+                    if(Of0)
+                        Of0(Rm1 + N4 * N0, Rm3 + (N4 - 1) * N3, Rm1 + (N4 - 1) * N0, N3, Nv2, Nv3, Rv2);
+                    else {
+                        Op0(Rm1 + N4 * N0, Rm1 + (N4 - 1) * N0);
+                        Mlc_RvtNNvNvRvRv_0(Rm3 + (N4 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + N4 * N0);
+                    }
+
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N2 + 1);
+                }
 
-                // LS column.
-                Mlc_RvtNNvNvRvRv_0(Rm1 + N5 * N0, N0, Nv0, Nv1, Rv0, Rm1 + N6 * N0);
+                // Truncated Arnoldi and sketching, second part.
+                for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
 
-                // Sketch application.
-                Mlc_RvtNNvNvRvRv_0(Rm3 + (N4 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + N5 * N0);
+                    // Indices.
+                    const natural_t N5 = N4 % (N2 + 1);
+                    const natural_t N6 = (N4 - 1) % (N2 + 1);
 
-                // (Re-)orthogonalization.
-                for(natural_t N7 = 0; N7 < 2; ++N7)
-                    for(natural_t N8 = 0; N8 <= N2; ++N8) {
-                        if(N5 == N8)
-                            continue;
+                    // Zeroing.
+                    #pragma omp parallel for
+                    for(natural_t N7 = 0; N7 < N0; ++N7)
+                        Rm1[N5 * N0 + N7] = 0.0;
 
-                        Prj_RvtRvRvN_0(Rm1 + N5 * N0, Rm1 + N8 * N0, Rm1 + N5 * N0, N0);
+                    // LS column and sketch application.
+                    if(Of0)
+                        Of0(Rm1 + N5 * N0, Rm3 + (N4 - 1) * N3, Rm1 + N6 * N0, N3, Nv2, Nv3, Rv2);
+                    else {
+                        Op0(Rm1 + N5 * N0, Rm1 + N6 * N0);
+                        Mlc_RvtNNvNvRvRv_0(Rm3 + (N4 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + N5 * N0);
                     }
 
-                // Normalization.
-                Nrz_RvtN_0(Rm1 + N5 * N0, N0);
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N2 + 1);
+                }
             }
 
             // Zeroing.
@@ -258,11 +747,46 @@ namespace nass {
             for(natural_t N7 = 0; N7 < N0; ++N7)
                 Rm1[(N1 % (N2 + 1)) * N0 + N7] = 0.0;
 
-            // LS column.
-            Mlc_RvtNNvNvRvRv_0(Rm1 + (N1 % (N2 + 1)) * N0, N0, Nv0, Nv1, Rv0, Rm1 + ((N1 - 1) % (N2 + 1)) * N0);
+            // LS column and sketch application.
+            if(Of0)
+                Of0(Rm1 + (N1 % (N2 + 1)) * N0, Rm3 + (N1 - 1) * N3, Rm1 + ((N1 - 1) % (N2 + 1)) * N0, N3, Nv2, Nv3, Rv2);
+            else {
+                Op0(Rm1 + (N1 % (N2 + 1)) * N0, Rm1 + ((N1 - 1) % (N2 + 1)) * N0);
+                Mlc_RvtNNvNvRvRv_0(Rm3 + (N1 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + (N1 % (N2 + 1)) * N0);
+            }
+
+            #else
+
+            // Truncated Arnoldi and sketching, lagged: the LS column of every column is recurred from the product of its lagged version.
+            for(natural_t N4 = 0; N4 < N1; ++N4) {
+
+                // Indices.
+                const natural_t N5 = N4 % (N2 + 2);
+                const natural_t N6 = (N4 + 1) % (N2 + 2);
+
+                // Zeroing.
+                if(N4 + 1 >= N2 + 2) {
+                    #pragma omp parallel for
+                    for(natural_t N7 = 0; N7 < N0; ++N7)
+                        Rm1[N6 * N0 + N7] = 0.0;
+                }
+
+                // Product of the lagged column and sketch application.
+                if(Of0)
+                    Of0(Rm1 + N6 * N0, Rm3 + N4 * N3, Rm1 + N5 * N0, N3, Nv2, Nv3, Rv2);
+                else {
+                    Op0(Rm1 + N6 * N0, Rm1 + N5 * N0);
+                    Mlc_RvtNNvNvRvRv_0(Rm3 + N4 * N3, N0, Nv2, Nv3, Rv2, Rm1 + N6 * N0);
+                }
+
+                // Lagged (re-)orthogonalization and normalization.
+                const scalar_t R3 = Lso_RmtRvtNNNNB_R(Rm1, Rv9, N0, N4, N2, N2 + 2, N4 + 1 < N1);
+
+                // Sketched LS matrix, recurred in place.
+                Rec_RmtRvRvNNNR_0(Rm3, Rm3 + N4 * N3, Rv9, N3, N4, N2, R3);
+            }
 
-            // Sketch application.
-            Mlc_RvtNNvNvRvRv_0(Rm3 + (N1 - 1) * N3, N0, Nv2, Nv3, Rv2, Rm1 + (N1 % (N2 + 1)) * N0);
+            #endif
 
             #endif
 
@@ -286,7 +810,7 @@ namespace nass {
 
             // Sketch matrix.
             #if defined(SPARSE_SKETCH)
-            Mlc_RmtNNNvNvRvRmN_0(Rm3, N3, N0, Nv2, Nv3, Rv2, Rm2, N1);
+            Mlc_RmtNNNvNvRvRmNRvt_0(Rm3, N3, N0, Nv2, Nv3, Rv2, Rm2, N1, Rv14);
             #elif defined(GAUSS_SKETCH)
             Ml_RmtRmRmNNN_0(Rm3, Rm0, Rm2, N3, N0, N1);
             #endif
@@ -317,10 +841,10 @@ namespace nass {
 
 
             // Condition number estimate.
-            real_t R0 = std::abs(Rm3[0]), R1 = std::abs(Rm3[0]);
+            scalar_t R0 = std::abs(Rm3[0]), R1 = std::abs(Rm3[0]);
 
             for(natural_t N4 = 1; N4 < N1; ++N4) {
-                const real_t R2 = std::abs(Rm3[N4 * (N3 + 1)]);
+                const scalar_t R2 = std::abs(Rm3[N4 * (N3 + 1)]);
 
                 if(R2 < R0)
                     R0 = R2;
@@ -340,7 +864,7 @@ namespace nass {
 
             // (Reduced) LS problem, backward substitution.
             for(natural_t N4 = N1; N4 > 0; --N4) {
-                real_t R2 = 0.0;
+                scalar_t R2 = 0.0;
 
                 for(natural_t N5 = N4; N5 < N1; ++N5)
                     R2 += Rm3[N5 * N3 + N4 - 1] * Rv6[N5];
@@ -360,7 +884,7 @@ namespace nass {
                 Rv8[N4] -= Rv5[N4];
 
             // Residual estimation. [!] Q needs to be truncated.
-            const real_t R2 = Nr_RvN_R(Rv8, N3);
+            const scalar_t R2 = Nr_RvN_R(Rv8, N3);
 
 
             #ifndef NVERBOSE
@@ -386,67 +910,138 @@ namespace nass {
             Cp_RvtRvN_0(Rm1, Rv4, N0);
             Nrz_RvtN_0(Rm1, N0);
 
+            #ifndef LOW_SYNC
+
             // Solution update.
             #pragma omp parallel for
             for(natural_t N5 = 0; N5 < N0; ++N5)
                 Rvt0[N5] += Rm1[N5] * Rv7[0];
 
-            // Truncated Arnoldi and solution update, first part.
-            for(natural_t N4 = 1; N4 <= N2; ++N4) {
+            if(Pw0) {
+                const natural_t N7 = std::min(powers_steps, N1 - 1);
 
-                // Zeroing.
-                #pragma omp parallel for
-                for(natural_t N5 = 0; N5 < N0; ++N5)
-                    Rm1[N4 * N0 + N5] = 0.0;
+                // Arnoldi and solution update, first sweep, by the plain operator.
+                for(natural_t N4 = 1; N4 <= N7; ++N4) {
 
-                // LS column.
-                Mlc_RvtNNvNvRvRv_0(Rm1 + N4 * N0, N0, Nv0, Nv1, Rv0, Rm1 + (N4 - 1) * N0);
+                    // Indices.
+                    const natural_t N5 = N4 % (N2 + 1);
+                    const natural_t N6 = (N4 - 1) % (N2 + 1);
 
-                // (Re-)orthogonalization.
-                for(natural_t N5 = 0; N5 < 2; ++N5)
-                    for(natural_t N6 = 0; N6 < N4; ++N6)
-                        Prj_RvtRvRvN_0(Rm1 + N4 * N0, Rm1 + N6 * N0, Rm1 + N4 * N0, N0);
+                    // Zeroing.
+                    #pragma omp parallel for
+                    for(natural_t N8 = 0; N8 < N0; ++N8)
+                        Rm1[N5 * N0 + N8] = 0.0;
 
-                // Normalization.
-                Nrz_RvtN_0(Rm1 + N4 * N0, N0);
+                    // LS column.
+                    Op0(Rm1 + N5 * N0, Rm1 + N6 * N0);
 
-                // Solution update.
-                const real_t R3 = Rv7[N4];
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N2 + 1);
 
-                #pragma omp parallel for
-                for(natural_t N5 = 0; N5 < N0; ++N5)
-                    Rvt0[N5] += Rm1[N4 * N0 + N5] * R3;
-            }
+                    // Solution update.
+                    const scalar_t R3 = Rv7[N4];
 
-            // Truncated Arnoldi, second part.
-            for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
+                    #pragma omp parallel for
+                    for(natural_t N8 = 0; N8 < N0; ++N8)
+                        Rvt0[N8] += Rm1[N5 * N0 + N8] * R3;
+                }
 
-                // Indices.
-                const natural_t N5 = N4 % (N2 + 1);
-                const natural_t N6 = (N4 - 1) % (N2 + 1);
+                // s-step Arnoldi and solution update, on the first pass' shifts.
+                for(natural_t N4 = N7; N4 + 1 < N1; N4 += powers_steps) {
+                    const natural_t N5 = std::min(powers_steps, N1 - N4 - 1);
 
-                // Zeroing.
-                #pragma omp parallel for
-                for(natural_t N7 = 0; N7 < N0; ++N7)
-                    Rm1[N5 * N0 + N7] = 0.0;
+                    // Scaled Newton basis.
+                    Pw0(Rm5, Rm1 + (N4 % (N2 + 1)) * N0, Rv10, N5);
+
+                    for(natural_t N6 = 1; N6 <= N5; ++N6) {
+                        const natural_t N7 = (N4 + N6) % (N2 + 1);
 
-                // LS column.
-                Mlc_RvtNNvNvRvRv_0(Rm1 + N5 * N0, N0, Nv0, Nv1, Rv0, Rm1 + N6 * N0);
+                        // Copy, (re-)orthogonalization and normalization.
+                        Cp_RvtRvN_0(Rm1 + N7 * N0, Rm5 + (N6 - 1) * N0, N0);
+                        [[maybe_unused]] const scalar_t R3 = Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4 + N6, N2, N2 + 1);
 
-                // (Re-)orthogonalization.
-                for(natural_t N7 = 0; N7 < 2; ++N7)
-                    for(natural_t N8 = 0; N8 <= N2; ++N8) {
-                        if(N5 == N8)
-                            continue;
+                        // Solution update.
+                        const scalar_t R4 = Rv7[N4 + N6];
 
-                        Prj_RvtRvRvN_0(Rm1 + N5 * N0, Rm1 + N8 * N0, Rm1 + N5 * N0, N0);
+                        #pragma omp parallel for
+                        for(natural_t N8 = 0; N8 < N0; ++N8)
+                            Rvt0[N8] += Rm1[N7 * N0 + N8] * R4;
                     }
+                }
+            } else {
+
+                // Truncated Arnoldi and solution update, first part.
+                for(natural_t N4 = 1; N4 <= N2; ++N4) {
+
+                    // Zeroing.
+                    #pragma omp parallel for
+                    for(natural_t N5 = 0; N5 < N0; ++N5)
+                        Rm1[N4 * N0 + N5] = 0.0;
+
+                    // LS column.
+                    Op0(Rm1 + N4 * N0, Rm1 + (N4 - 1) * N0);
+
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N2 + 1);
+
+                    // Solution update.
+                    const scalar_t R3 = Rv7[N4];
+
+                    #pragma omp parallel for
+                    for(natural_t N5 = 0; N5 < N0; ++N5)
+                        Rvt0[N5] += Rm1[N4 * N0 + N5] * R3;
+                }
+
+                // Truncated Arnoldi, second part.
+                for(natural_t N4 = N2 + 1; N4 < N1; ++N4) {
+
+                    // Indices.
+                    const natural_t N5 = N4 % (N2 + 1);
+                    const natural_t N6 = (N4 - 1) % (N2 + 1);
+
+                    // Zeroing.
+                    #pragma omp parallel for
+                    for(natural_t N7 = 0; N7 < N0; ++N7)
+                        Rm1[N5 * N0 + N7] = 0.0;
+
+                    // LS column.
+                    Op0(Rm1 + N5 * N0, Rm1 + N6 * N0);
+
+                    // (Re-)orthogonalization and normalization.
+                    Ort_RmtRvtNNNN_R(Rm1, Rv9, N0, N4, N2, N2 + 1);
+
+                    // Solution update.
+                    const scalar_t R3 = Rv7[N4];
+
+                    #pragma omp parallel for
+                    for(natural_t N7 = 0; N7 < N0; ++N7)
+                        Rvt0[N7] += Rm1[N5 * N0 + N7] * R3;
+                }
+            }
+
+            #else
+
+            // Truncated Arnoldi and solution update, lagged: every column is added once final, one step after its product.
+            for(natural_t N4 = 0; N4 < N1; ++N4) {
+
+                // Indices.
+                const natural_t N5 = N4 % (N2 + 2);
+                const natural_t N6 = (N4 + 1) % (N2 + 2);
+
+                // Zeroing and product of the lagged column, but the last one.
+                if(N4 + 1 < N1) {
+                    #pragma omp parallel for
+                    for(natural_t N7 = 0; N7 < N0; ++N7)
+                        Rm1[N6 * N0 + N7] = 0.0;
 
-                // Normalization.
-                Nrz_RvtN_0(Rm1 + N5 * N0, N0);
+                    Op0(Rm1 + N6 * N0, Rm1 + N5 * N0);
+                }
+
+                // Lagged (re-)orthogonalization and normalization.
+                Lso_RmtRvtNNNNB_R(Rm1, Rv9, N0, N4, N2, N2 + 2, N4 + 1 < N1);
 
                 // Solution update.
-                const real_t R3 = Rv7[N4];
+                const scalar_t R3 = Rv7[N4];
 
                 #pragma omp parallel for
                 for(natural_t N7 = 0; N7 < N0; ++N7)
@@ -455,6 +1050,8 @@ namespace nass {
 
             #endif
 
+            #endif
+
 
             #ifndef NVERBOSE
             T1 = std::chrono::high_resolution_clock::now();
@@ -472,6 +1069,17 @@ namespace nass {
 
             #ifndef NVERBOSE
             T0 = std::chrono::high_resolution_clock::now();
+
+            // Basis pages per node.
+            #ifndef MEMORY_PRIORITY
+            const std::vector<natural_t> Nv5 = Plc_CvN_Nv(Rm1, N0 * N1 * sizeof(scalar_t));
+            #else
+            #ifndef LOW_SYNC
+            const std::vector<natural_t> Nv5 = Plc_CvN_Nv(Rm1, N0 * (N2 + 1) * sizeof(scalar_t));
+            #else
+            const std::vector<natural_t> Nv5 = Plc_CvN_Nv(Rm1, N0 * (N2 + 2) * sizeof(scalar_t));
+            #endif
+            #endif
             #endif
 
 
@@ -494,6 +1102,12 @@ namespace nass {
             delete[] Rv6;
             delete[] Rv7;
             delete[] Rv8;
+            delete[] Rm5; delete[] Rv9;
+            delete[] Rm6; delete[] Rv10;
+
+            #ifdef MEMORY_PRIORITY
+            delete[] Rv11;
+            #endif
 
 
             #ifndef NVERBOSE
@@ -504,11 +1118,131 @@ namespace nass {
 
 
             #ifndef NVERBOSE
+            std::println("Placement:\n\tBasis, pages per node: {}, unplaced: {}", std::span(Nv5.data(), Nds_0_N()), Nv5.back());
             std::println("---");
             #endif
 
             return {R2, R1 / R0};
         }
 
+
+        /**
+         * @brief Sketched GMRES, reordered system.
+         * The right-hand side and the initial guess are permuted, the system is solved in the permuted space and the solution is permuted back.
+         *
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv], new to old indices, see Rcm_NNvNv_Nv.
+         * @param Op0 Operator [Op], permuted.
+         * @param Of0 Fused operator [Of], permuted, possibly empty.
+         * @param Pw0 Matrix powers [Pw], permuted, possibly empty.
+         * @param Rv0 Real vector [Rv].
+         * @param N1 Natural number [N].
+         * @param N2 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         * @return std::array<scalar_t, 2> Real numbers [R].
+         */
+        template<typename scalar_t>
+        std::array<scalar_t, 2> sGMRES_RvNNvOpOfPwRvNN_RR(scalar_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const operator_t<scalar_t>& Op0, const fused_t<scalar_t>& Of0, const powers_t<scalar_t>& Pw0, const scalar_t* Rv0, const natural_t& N1, const natural_t& N2) {
+            scalar_t* Rv1 = new scalar_t[N0];
+            scalar_t* Rv2 = new scalar_t[N0];
+
+            Prm_RvtRvNvN_0(Rv1, Rvt0, Nv0, N0);
+            Prm_RvtRvNvN_0(Rv2, Rv0, Nv0, N0);
+
+            const auto [R0, R1] = sGMRES_RvNOpOfPwRvNN_RR(Rv1, N0, Op0, Of0, Pw0, Rv2, N1, N2);
+
+            Ipr_RvtRvNvN_0(Rvt0, Rv1, Nv0, N0);
+
+            delete[] Rv1;
+            delete[] Rv2;
+
+            return {R0, R1};
+        }
+
+
+        /**
+         * @brief Values of a sparse matrix as solved, narrowed into a copy below real_t.
+         *
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         * @return const scalar_t* Real vector [Rv], Rv0 itself for real_t.
+         */
+        template<typename scalar_t>
+        [[nodiscard]] static const scalar_t* Vls_RvN_Rv(const real_t* Rv0, const natural_t& N0) {
+            if constexpr(std::is_same_v<scalar_t, real_t>)
+                return Rv0;
+            else
+                return Nrw_RvN_Rv<scalar_t>(Rv0, N0);
+        }
+
+
+        /**
+         * @brief Releases values from Vls_RvN_Rv.
+         *
+         * @param Rv0 Real vector [Rv].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static void Clv_Rv_0(const scalar_t* Rv0) {
+            if constexpr(!std::is_same_v<scalar_t, real_t>)
+                delete[] Rv0;
+        }
+
+
+        /**
+         * @brief Sketched GMRES, (CSC) sparse matrix, split by rows among threads, see Spl_NNvNv_NNvNv.
+         * Other layouts, (DIA), (SELL-C-σ) or tuned, are solved by sGMRES_RvNOpOfPwRvNN_RR through their own operators.
+         * Values are stored in scalar_t for the solve, a float solve streaming 4-byte values, see Vls_RvN_Rv.
+         *
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N1 Natural number [N].
+         * @param N2 Natural number [N].
+         * @tparam index_t Index type.
+         * @tparam scalar_t Scalar type.
+         * @return std::array<scalar_t, 2> Real numbers [R].
+         */
+        template<typename index_t, typename scalar_t>
+        std::array<scalar_t, 2> sGMRES_RvNNvNvRvRvNN_RR(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const scalar_t* Rv1, const natural_t& N1, const natural_t& N2) {
+            const scalar_t* Rv5 = Vls_RvN_Rv<scalar_t>(Rv0, Nv0[N0]);
+
+            const auto [N3, Nv2, Nv3] = Spl_NNvNv_NNvNv(N0, Nv0, Nv1);
+            std::vector<scalar_t> Rv6; // Products' windows and private sketches, for the solve.
+
+            const operator_t<scalar_t> Op0 = [&](scalar_t* Rvt1, const scalar_t* Rv2) { Mlc_RvtNNvNvRvRvNNvNvRvt_0(Rvt1, N0, Nv0, Nv1, Rv5, Rv2, N3, Nv2, Nv3, Rv6); };
+            const fused_t<scalar_t> Of0 = [&](scalar_t* Rvt1, scalar_t* Rvt2, const scalar_t* Rv2, const natural_t& N5, const natural_t* Nv4, const natural_t* Nv5, const scalar_t* Rv4) { Mlk_RvtRvtNNvNvRvRvNNvNvNNvNvRvRvt_0(Rvt1, Rvt2, N0, Nv0, Nv1, Rv5, Rv2, N3, Nv2, Nv3, N5, Nv4, Nv5, Rv4, Rv6); };
+
+            const auto [R0, R1] = sGMRES_RvNOpOfPwRvNN_RR(Rvt0, N0, Op0, Of0, powers_t<scalar_t>{}, Rv1, N1, N2);
+
+            delete[] Nv2;
+            delete[] Nv3;
+
+            Clv_Rv_0(Rv5);
+
+            return {R0, R1};
+        }
+
+
+        // Instantiations.
+
+        #define NASS_SOLVER_INSTANTIATE(scalar_t) \
+            template scalar_t Ort_RmtRvtNNNN_R(scalar_t*, scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&); \
+            template scalar_t Lso_RmtRvtNNNNB_R(scalar_t*, scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&, const bool&); \
+            template std::array<scalar_t, 2> sGMRES_RvNOpOfPwRvNN_RR(scalar_t*, const natural_t&, const operator_t<scalar_t>&, const fused_t<scalar_t>&, const powers_t<scalar_t>&, const scalar_t*, const natural_t&, const natural_t&); \
+            template std::array<scalar_t, 2> sGMRES_RvNNvOpOfPwRvNN_RR(scalar_t*, const natural_t&, const natural_t*, const operator_t<scalar_t>&, const fused_t<scalar_t>&, const powers_t<scalar_t>&, const scalar_t*, const natural_t&, const natural_t&); \
+            template std::array<scalar_t, 2> sGMRES_RvNNvNvRvRvNN_RR(scalar_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*, const scalar_t*, const natural_t&, const natural_t&); \
+            template std::array<scalar_t, 2> sGMRES_RvNNvNvRvRvNN_RR(scalar_t*, const natural_t&, const natural32_t*, const natural32_t*, const real_t*, const scalar_t*, const natural_t&, const natural_t&);
+
+        NASS_SOLVER_INSTANTIATE(double)
+        NASS_SOLVER_INSTANTIATE(float)
+
+        #undef NASS_SOLVER_INSTANTIATE
+
     }
 }
\ No newline at end of file
@@ -11,154 +11,3245 @@
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
-#include <fstream>
-#include <sstream>
 #include <cassert>
 #include <cstring>
+#include <charconv>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <random>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <vector>
+#include <deque>
+#include <utility>
+#include <string_view>
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <cerrno>
+#include <print>
+
+#include <zlib.h>
 
 #include "../include/Sparse.hpp"
+#include "../include/Dispatch.hpp"
+
+// Compressed input: decompressed block size, queued blocks per parsing thread, banner buffer.
+#define STREAM_BLOCK (1 << 22)
+#define STREAM_QUEUE 2
+#define STREAM_BANNER 1024
+
+// Diagonal products: rows per block.
+#define DIA_BLOCK 4096
+
+// Multivector products: packed rows per tile.
+#define MULTI_BLOCK 256
+
+// Sliced ELLPACK products: gathered columns of a chunk per tile.
+#define SELL_TILE 64
+
+// Matrix powers: bytes of a block's entries and levels.
+#define POWERS_BYTES (1 << 20)
+
+// Reverse Cuthill-McKee: pseudo-peripheral root sweeps.
+#define RCM_SWEEPS 5
+
+// Radix sort digit.
+#define RADIX_BITS 11
+#define RADIX_SIZE (1 << RADIX_BITS)
+
+// Prefix sums: counts per thread.
+#define PREFIX_BLOCK (1 << 16)
+
+namespace nass {
+    namespace internal {
+
+        /**
+         * @brief Reports a failed file operation, from errno, and exits.
+         * 
+         * @param St0 String [St], operation.
+         * @param St1 String [St], path.
+         */
+        [[noreturn]] static void Err_StSt_0(const std::string& St0, const std::string& St1) {
+            std::println(stderr, "Error: {} failed on {}: {}", St0, St1, std::strerror(errno));
+            std::exit(EXIT_FAILURE);
+        }
+
+
+        /**
+         * @brief Reports a failed file operation, from its own message, and exits.
+         * 
+         * @param St0 String [St], operation.
+         * @param St1 String [St], path.
+         * @param St2 String [St], message.
+         */
+        [[noreturn]] static void Err_StStSt_0(const std::string& St0, const std::string& St1, const std::string& St2) {
+            std::println(stderr, "Error: {} failed on {}: {}", St0, St1, St2);
+            std::exit(EXIT_FAILURE);
+        }
+
+
+        /**
+         * @brief Maps a file into memory.
+         * 
+         * @param St0 String [St].
+         * @return std::tuple<const char*, natural_t> Mapped file and its size.
+         */
+        [[nodiscard]] static std::tuple<const char*, natural_t> Mm_St_CvN(const std::string& St0) {
+            const int I0 = open(St0.c_str(), O_RDONLY);
+
+            if(I0 < 0)
+                Err_StSt_0("open", St0);
+
+            struct stat S0;
+
+            if(fstat(I0, &S0) != 0)
+                Err_StSt_0("fstat", St0);
+
+            const natural_t N0 = static_cast<natural_t>(S0.st_size);
+            void* V0 = mmap(nullptr, N0, PROT_READ, MAP_PRIVATE, I0, 0);
+
+            if(V0 == MAP_FAILED)
+                Err_StSt_0("mmap", St0);
+
+            // The mapping outlives the descriptor.
+            close(I0);
+
+            madvise(V0, N0, MADV_WILLNEED);
+
+            return {static_cast<const char*>(V0), N0};
+        }
+
+
+        /**
+         * @brief Skips blanks.
+         * 
+         * @param C0 Cursor.
+         * @param C1 End.
+         * @return const char* Cursor.
+         */
+        static inline const char* Sk_CC_C(const char* C0, const char* C1) {
+            while(C0 < C1 && (*C0 == ' ' || *C0 == '\t' || *C0 == '\r'))
+                ++C0;
+
+            return C0;
+        }
+
+
+        /**
+         * @brief Checks the (.mtx) banner for the symmetric qualifier.
+         * 
+         * @param C0 Mapped file.
+         * @param N0 Natural number [N], size.
+         * @return bool Boolean [B].
+         */
+        [[nodiscard]] static bool Sym_CvN_B(const char* C0, const natural_t& N0) {
+            const char* C1 = static_cast<const char*>(std::memchr(C0, '\n', N0));
+            const std::string_view St0(C0, C1 ? C1 - C0 : N0);
+
+            if(!St0.starts_with("%%MatrixMarket"))
+                return false;
+
+            // Last token, skew-symmetric is not supported.
+            const natural_t N1 = St0.find_last_not_of(" \t\r");
+            const natural_t N2 = St0.find_last_of(" \t", N1);
+
+            return St0.substr(N2 + 1, N1 - N2) == "symmetric";
+        }
+
+
+        /**
+         * @brief Strict lexicographic order between two pairs.
+         * 
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N].
+         * @param N2 Natural number [N].
+         * @param N3 Natural number [N].
+         * @return bool (N0, N1) < (N2, N3).
+         */
+        static inline bool Lx_NNNN_B(const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            return N0 < N2 || (N0 == N2 && N1 < N3);
+        }
+
+
+        /**
+         * @brief Parses the (.mtx) header, skipping comments.
+         * 
+         * @param C0 Cursor.
+         * @param C1 End.
+         * @param Nt0 Natural number [N], target [t], rows.
+         * @param Nt1 Natural number [N], target [t], columns.
+         * @param Nt2 Natural number [N], target [t], entries.
+         * @return const char* Cursor, first entry.
+         */
+        static const char* Hd_CCNtNtNt_C(const char* C0, const char* C1, natural_t& Nt0, natural_t& Nt1, natural_t& Nt2) {
+
+            // Skips.
+            while(C0 < C1 && *C0 == '%') {
+                C0 = static_cast<const char*>(std::memchr(C0, '\n', C1 - C0));
+                C0 = C0 ? C0 + 1 : C1;
+            }
+
+            // Parameters.
+            C0 = std::from_chars(Sk_CC_C(C0, C1), C1, Nt0).ptr; // Rows.
+            C0 = std::from_chars(Sk_CC_C(C0, C1), C1, Nt1).ptr; // Columns.
+            C0 = std::from_chars(Sk_CC_C(C0, C1), C1, Nt2).ptr; // Entries.
+
+            C0 = static_cast<const char*>(std::memchr(C0, '\n', C1 - C0));
+
+            return C0 ? C0 + 1 : C1;
+        }
+
+
+        /**
+         * @brief Parses the (.mtx) entries between two line-aligned cursors.
+         * Checks whether the parsed entries are strictly sorted by (column, row) and by (row, column).
+         * 
+         * @param C0 Cursor.
+         * @param C1 End.
+         * @param Nvt0 Natural vector [Nv], target [t], rows.
+         * @param Nvt1 Natural vector [Nv], target [t], columns.
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Nt0 Natural number [N], target [t], entry lines, stored zeros included.
+         * @param B0 Boolean [B], column ordering.
+         * @param B1 Boolean [B], row ordering.
+         * @tparam index_t Index type.
+         * @return natural_t Natural number [N], entries.
+         */
+        template<typename index_t>
+        static natural_t Prs_CCNvtNvtRvtNt_N(const char* C0, const char* C1, index_t* Nvt0, index_t* Nvt1, real_t* Rvt0, natural_t& Nt0, bool& B0, bool& B1) {
+            natural_t N0 = 0;
+
+            Nt0 = 0;
+            B0 = true; B1 = true;
+
+            while(C0 < C1) {
+                natural_t N1 = 0, N2 = 0;
+                real_t R0 = 0.0;
+
+                // Coordinates and entry.
+                const char* C2 = Sk_CC_C(C0, C1);
+
+                if(C2 < C1 && *C2 != '\n') {
+                    C2 = std::from_chars(C2, C1, N1).ptr; // Row.
+                    C2 = std::from_chars(Sk_CC_C(C2, C1), C1, N2).ptr; // Column.
+                    C2 = std::from_chars(Sk_CC_C(C2, C1), C1, R0).ptr; // Entry.
+
+                    ++Nt0;
+
+                    // Sparse check.
+                    if(std::abs(R0) >= real_tol) {
+                        if(N0 > 0) {
+                            B0 = B0 && Lx_NNNN_B(Nvt1[N0 - 1], Nvt0[N0 - 1], N2 - 1, N1 - 1);
+                            B1 = B1 && Lx_NNNN_B(Nvt0[N0 - 1], Nvt1[N0 - 1], N1 - 1, N2 - 1);
+                        }
+
+                        Nvt0[N0] = static_cast<index_t>(N1 - 1);
+                        Nvt1[N0] = static_cast<index_t>(N2 - 1);
+                        Rvt0[N0] = R0;
+
+                        ++N0;
+                    }
+                }
+
+                // Next line.
+                C2 = static_cast<const char*>(std::memchr(C2, '\n', C1 - C2));
+                C0 = C2 ? C2 + 1 : C1;
+            }
+
+            return N0;
+        }
+
+
+        /**
+         * @brief Loads the entries of a mapped (.mtx) file, parsing in parallel over line-aligned chunks.
+         * Checks whether the entries are strictly sorted by (column, row) and by (row, column), and whether the matrix is symmetric.
+         * 
+         * @param St0 String [St].
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t, index_t*, index_t*, real_t*, bool, bool, bool> Size, entries, (COO) sparse matrix [Spo], column and row ordering, symmetry.
+         */
+        template<typename index_t>
+        [[nodiscard]] static std::tuple<natural_t, natural_t, index_t*, index_t*, real_t*, bool, bool, bool> Mtxm_St_NNNvNvRvBBB(const std::string& St0) {
+            const auto [C0, N0] = Mm_St_CvN(St0);
+            const char* C1 = C0 + N0;
+
+            // Symmetry, from the banner.
+            const bool B2 = Sym_CvN_B(C0, N0);
+
+            // Parameters.
+            natural_t N1, N2, N3;
+
+            const char* C2 = Hd_CCNtNtNt_C(C0, C1, N1, N2, N3);
+
+            // Square check.
+            assert(N1 == N2);
+
+            // Chunks.
+            #ifdef _OPENMP
+            const natural_t N4 = static_cast<natural_t>(omp_get_max_threads());
+            #else
+            const natural_t N4 = 1;
+            #endif
+
+            const char** Cv0 = new const char*[N4 + 1];
+            natural_t* Nv0 = new natural_t[N4 + 1];
+            natural_t* Nv1 = new natural_t[N4];
+            natural_t* Nv4 = new natural_t[N4]; // Entry lines.
+
+            // Orderings, per chunk.
+            bool* Bv0 = new bool[N4];
+            bool* Bv1 = new bool[N4];
+
+            Cv0[0] = C2;
+            Cv0[N4] = C1;
+
+            for(natural_t N5 = 1; N5 < N4; ++N5) {
+                const char* C3 = C2 + (C1 - C2) * N5 / N4;
+
+                if(C3 < Cv0[N5 - 1])
+                    C3 = Cv0[N5 - 1];
+
+                // Line alignment.
+                if(C3 > C2 && C3[-1] != '\n') {
+                    C3 = static_cast<const char*>(std::memchr(C3, '\n', C1 - C3));
+                    C3 = C3 ? C3 + 1 : C1;
+                }
+
+                Cv0[N5] = C3;
+            }
+
+            // Lines per chunk, upper bound on entries.
+            Nv0[0] = 0;
+
+            #pragma omp parallel for
+            for(natural_t N5 = 0; N5 < N4; ++N5) {
+                natural_t N6 = std::count(Cv0[N5], Cv0[N5 + 1], '\n');
+
+                if(Cv0[N5 + 1] > Cv0[N5] && Cv0[N5 + 1][-1] != '\n')
+                    ++N6;
+
+                Nv0[N5 + 1] = N6;
+            }
+
+            for(natural_t N5 = 0; N5 < N4; ++N5)
+                Nv0[N5 + 1] += Nv0[N5];
+
+            // Initialization.
+            const natural_t N5 = Nv0[N4] > N3 ? Nv0[N4] : N3;
+
+            index_t* Nv2 = new index_t[N5]; // Rows.
+            index_t* Nv3 = new index_t[N5]; // Columns.
+            real_t* Rv0 = new real_t[N5];
+
+            // Reading.
+            #pragma omp parallel for
+            for(natural_t N6 = 0; N6 < N4; ++N6) {
+                const char* C3 = Cv0[N6];
+                const char* C4 = Cv0[N6 + 1];
+
+                bool B0, B1;
+
+                const natural_t N7 = Prs_CCNvtNvtRvtNt_N(C3, C4, Nv2 + Nv0[N6], Nv3 + Nv0[N6], Rv0 + Nv0[N6], Nv4[N6], B0, B1);
+
+                Nv1[N6] = N7;
+                Bv0[N6] = B0;
+                Bv1[N6] = B1;
+            }
+
+            // Entries check, against the header, stored zeros included.
+            natural_t N8 = 0;
+
+            for(natural_t N7 = 0; N7 < N4; ++N7)
+                N8 += Nv4[N7];
+
+            if(N8 != N3)
+                Err_StStSt_0("parsing", St0, std::to_string(N8) + " entries, " + std::to_string(N3) + " expected");
+
+            // Compaction, only if some lines were skipped.
+            natural_t N6 = 0;
+
+            for(natural_t N7 = 0; N7 < N4; ++N7) {
+                if(N6 != Nv0[N7]) {
+                    std::memmove(Nv2 + N6, Nv2 + Nv0[N7], Nv1[N7] * sizeof(index_t));
+                    std::memmove(Nv3 + N6, Nv3 + Nv0[N7], Nv1[N7] * sizeof(index_t));
+                    std::memmove(Rv0 + N6, Rv0 + Nv0[N7], Nv1[N7] * sizeof(real_t));
+                }
+
+                Nv0[N7] = N6;
+                N6 += Nv1[N7];
+            }
+
+            // Orderings, across chunks.
+            bool B0 = true, B1 = true;
+
+            for(natural_t N7 = 0; N7 < N4; ++N7) {
+                B0 = B0 && Bv0[N7];
+                B1 = B1 && Bv1[N7];
+
+                // Chunk boundary.
+                if(N7 > 0 && Nv1[N7] > 0 && Nv0[N7] > 0) {
+                    B0 = B0 && Lx_NNNN_B(Nv3[Nv0[N7] - 1], Nv2[Nv0[N7] - 1], Nv3[Nv0[N7]], Nv2[Nv0[N7]]);
+                    B1 = B1 && Lx_NNNN_B(Nv2[Nv0[N7] - 1], Nv3[Nv0[N7] - 1], Nv2[Nv0[N7]], Nv3[Nv0[N7]]);
+                }
+            }
+
+            // Clean-up.
+            munmap(const_cast<char*>(C0), N0);
+
+            delete[] Cv0;
+            delete[] Nv0;
+            delete[] Nv1;
+            delete[] Nv4;
+            delete[] Bv0;
+            delete[] Bv1;
+
+            return {N1, N6, Nv2, Nv3, Rv0, B0, B1, B2};
+        }
+
+
+        /**
+         * @brief Loads the entries of a gzip-compressed (.mtx.gz) file.
+         * One thread decompresses and hands line-aligned blocks, through a bounded queue, to the parsing threads.
+         * Checks whether the entries are strictly sorted by (column, row) and by (row, column), and whether the matrix is symmetric.
+         * 
+         * @param St0 String [St].
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t, index_t*, index_t*, real_t*, bool, bool, bool> Size, entries, (COO) sparse matrix [Spo], column and row ordering, symmetry.
+         */
+        template<typename index_t>
+        [[nodiscard]] static std::tuple<natural_t, natural_t, index_t*, index_t*, real_t*, bool, bool, bool> Mtxz_St_NNNvNvRvBBB(const std::string& St0) {
+            using block_t = std::tuple<natural_t, std::vector<index_t>, std::vector<index_t>, std::vector<real_t>, bool, bool>;
+            using clock_t = std::chrono::steady_clock;
+
+            gzFile F0 = gzopen(St0.c_str(), "rb");
+
+            if(F0 == nullptr)
+                Err_StSt_0("gzopen", St0);
+
+            gzbuffer(F0, STREAM_BLOCK);
+
+            // Parsing threads.
+            #ifdef _OPENMP
+            const natural_t N0 = omp_get_max_threads() > 1 ? static_cast<natural_t>(omp_get_max_threads()) - 1 : 1;
+            #else
+            const natural_t N0 = 1;
+            #endif
+
+            // Bounded queue.
+            std::mutex M0;
+            std::condition_variable Cv0, Cv1; // Non-empty, non-full.
+            std::deque<std::pair<natural_t, std::string>> Q0;
+            bool B0 = false; // Decompression done.
+
+            // Header.
+            natural_t N1 = 0, N2 = 0, N3 = 0;
+            bool B1 = false;
+
+            // Decompression error, Z_BUF_ERROR on a truncated file.
+            int I1 = Z_OK;
+            std::string St2;
+
+            // Timings.
+            std::chrono::duration<double> D0{0}, D1{0}, D2{0}, D3{0};
+
+            // Entry lines, stored zeros included.
+            natural_t N10 = 0;
+
+            // Decompression.
+            std::thread Th0([&]() {
+                char* Cv2 = new char[STREAM_BLOCK];
+                std::string St1;
+
+                natural_t N4 = 0;
+                bool B2 = false, B3 = false; // Header, end of file.
+
+                while(!B3) {
+                    const auto T0 = clock_t::now();
+                    const int I0 = gzread(F0, Cv2, STREAM_BLOCK);
+                    D0 += clock_t::now() - T0;
+
+                    if(I0 > 0)
+                        St1.append(Cv2, I0);
+
+                    B3 = I0 <= 0;
+
+                    // Message, without the path zlib prefixes.
+                    if(B3) {
+                        St2 = gzerror(F0, &I1);
+
+                        if(St2.starts_with(St0 + ": "))
+                            St2.erase(0, St0.size() + 2);
+                    }
+
+                    // Header, once its size line is complete.
+                    if(!B2) {
+                        const char* C0 = St1.data();
+                        const char* C1 = C0 + St1.size();
+                        const char* C2 = C0;
+
+                        while(C2 < C1 && *C2 == '%') {
+                            C2 = static_cast<const char*>(std::memchr(C2, '\n', C1 - C2));
+                            C2 = C2 ? C2 + 1 : C1;
+                        }
+
+                        if(B3 || (C2 < C1 && std::memchr(C2, '\n', C1 - C2) != nullptr)) {
+                            B1 = Sym_CvN_B(C0, St1.size());
+                            St1.erase(0, Hd_CCNtNtNt_C(C0, C1, N1, N2, N3) - C0);
+
+                            B2 = true;
+                        }
+                    }
+
+                    // Line-aligned block.
+                    if(B2) {
+                        const natural_t N5 = B3 ? St1.size() : St1.rfind('\n') + 1;
+
+                        if(N5 > 0 && N5 <= St1.size()) {
+                            const auto T0 = clock_t::now();
+                            std::unique_lock<std::mutex> L0(M0);
+
+                            Cv1.wait(L0, [&]() { return Q0.size() < STREAM_QUEUE * N0; });
+                            D1 += clock_t::now() - T0;
+
+                            Q0.emplace_back(N4++, St1.substr(0, N5));
+                            L0.unlock();
+                            Cv0.notify_one();
+
+                            St1.erase(0, N5);
+                        }
+                    }
+                }
+
+                delete[] Cv2;
+
+                {
+                    std::lock_guard<std::mutex> L0(M0);
+                    B0 = true;
+                }
+
+                Cv0.notify_all();
+            });
+
+            // Parsing.
+            std::vector<std::vector<block_t>> Vv0(N0);
+
+            #pragma omp parallel num_threads(N0)
+            {
+                #ifdef _OPENMP
+                const natural_t N4 = static_cast<natural_t>(omp_get_thread_num());
+                #else
+                const natural_t N4 = 0;
+                #endif
+
+                std::chrono::duration<double> D4{0}, D5{0};
+                natural_t N8 = 0;
+
+                for(;;) {
+                    auto T0 = clock_t::now();
+                    std::unique_lock<std::mutex> L0(M0);
+
+                    Cv0.wait(L0, [&]() { return !Q0.empty() || B0; });
+                    D5 += clock_t::now() - T0;
+
+                    if(Q0.empty())
+                        break;
+
+                    auto [N5, St1] = std::move(Q0.front());
+                    Q0.pop_front();
+
+                    L0.unlock();
+                    Cv1.notify_one();
+
+                    T0 = clock_t::now();
+
+                    const char* C0 = St1.data();
+                    const char* C1 = C0 + St1.size();
+
+                    // Upper bound on entries.
+                    const natural_t N6 = std::count(C0, C1, '\n') + 1;
+
+                    std::vector<index_t> Nv0(N6), Nv1(N6);
+                    std::vector<real_t> Rv0(N6);
+                    natural_t N9;
+                    bool B2, B3;
+
+                    const natural_t N7 = Prs_CCNvtNvtRvtNt_N(C0, C1, Nv0.data(), Nv1.data(), Rv0.data(), N9, B2, B3);
+
+                    N8 += N9;
+
+                    Nv0.resize(N7); Nv1.resize(N7); Rv0.resize(N7);
+                    Vv0[N4].emplace_back(N5, std::move(Nv0), std::move(Nv1), std::move(Rv0), B2, B3);
+
+                    D4 += clock_t::now() - T0;
+                }
+
+                #pragma omp critical
+                {
+                    D2 = D4 > D2 ? D4 : D2;
+                    D3 = D5 > D3 ? D5 : D3;
+                    N10 += N8;
+                }
+            }
+
+            Th0.join();
+            gzclose(F0);
+
+            if(I1 != Z_OK)
+                Err_StStSt_0("gzread", St0, St2);
+
+            // Square check.
+            assert(N1 == N2);
+
+            // Assembly, in file order.
+            #ifndef NVERBOSE
+            const auto T0 = clock_t::now();
+            #endif
+
+            std::vector<block_t> Vv1;
+
+            for(auto& Vv2: Vv0)
+                for(auto& T1: Vv2)
+                    Vv1.push_back(std::move(T1));
+
+            std::sort(Vv1.begin(), Vv1.end(), [](const block_t& T1, const block_t& T2) { return std::get<0>(T1) < std::get<0>(T2); });
+
+            const natural_t N4 = Vv1.size();
+            natural_t* Nv0 = new natural_t[N4 + 1];
+
+            Nv0[0] = 0;
+
+            for(natural_t N5 = 0; N5 < N4; ++N5)
+                Nv0[N5 + 1] = Nv0[N5] + std::get<1>(Vv1[N5]).size();
+
+            const natural_t N5 = Nv0[N4];
+
+            // Entries check, against the header, stored zeros included.
+            if(N10 != N3)
+                Err_StStSt_0("parsing", St0, std::to_string(N10) + " entries, " + std::to_string(N3) + " expected");
+
+            index_t* Nv1 = new index_t[N5]; // Rows.
+            index_t* Nv2 = new index_t[N5]; // Columns.
+            real_t* Rv0 = new real_t[N5];
+
+            #pragma omp parallel for
+            for(natural_t N6 = 0; N6 < N4; ++N6) {
+                const auto& [N7, Nv3, Nv4, Rv1, B2, B3] = Vv1[N6];
+
+                std::memcpy(Nv1 + Nv0[N6], Nv3.data(), Nv3.size() * sizeof(index_t));
+                std::memcpy(Nv2 + Nv0[N6], Nv4.data(), Nv4.size() * sizeof(index_t));
+                std::memcpy(Rv0 + Nv0[N6], Rv1.data(), Rv1.size() * sizeof(real_t));
+            }
+
+            // Orderings.
+            bool B2 = true, B3 = true;
+
+            for(natural_t N6 = 0; N6 < N4; ++N6) {
+                B2 = B2 && std::get<4>(Vv1[N6]);
+                B3 = B3 && std::get<5>(Vv1[N6]);
+
+                // Block boundary.
+                if(N6 > 0 && Nv0[N6 + 1] > Nv0[N6] && Nv0[N6] > 0) {
+                    B2 = B2 && Lx_NNNN_B(Nv2[Nv0[N6] - 1], Nv1[Nv0[N6] - 1], Nv2[Nv0[N6]], Nv1[Nv0[N6]]);
+                    B3 = B3 && Lx_NNNN_B(Nv1[Nv0[N6] - 1], Nv2[Nv0[N6] - 1], Nv1[Nv0[N6]], Nv2[Nv0[N6]]);
+                }
+            }
+
+            delete[] Nv0;
+
+            #ifndef NVERBOSE
+            const auto T1 = clock_t::now();
+
+            std::println("--- Loading, gzip.");
+            std::println("Parameters: {}, {}, {}", N1, N5, N0);
+            std::println("Timings:");
+            std::println("\tDecompression: {}", std::chrono::duration_cast<std::chrono::milliseconds>(D0));
+            std::println("\tDecompression, waiting on the queue: {}", std::chrono::duration_cast<std::chrono::milliseconds>(D1));
+            std::println("\tParsing, slowest thread: {}", std::chrono::duration_cast<std::chrono::milliseconds>(D2));
+            std::println("\tParsing, waiting on the queue: {}", std::chrono::duration_cast<std::chrono::milliseconds>(D3));
+            std::println("\tAssembly: {}", std::chrono::duration_cast<std::chrono::milliseconds>(T1 - T0));
+            std::println("---");
+            #endif
+
+            return {N1, N5, Nv1, Nv2, Rv0, B2, B3, B1};
+        }
+
+
+        /**
+         * @brief Whether a path names a gzip-compressed file.
+         * 
+         * @param St0 String [St].
+         * @return bool Boolean [B].
+         */
+        static inline bool Gz_St_B(const std::string& St0) {
+            return St0.ends_with(".gz");
+        }
+
+
+        /**
+         * @brief Loads the entries of a (.mtx) or (.mtx.gz) file.
+         * 
+         * @param St0 String [St].
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t, index_t*, index_t*, real_t*, bool, bool, bool> Size, entries, (COO) sparse matrix [Spo], column and row ordering, symmetry.
+         */
+        template<typename index_t>
+        [[nodiscard]] static std::tuple<natural_t, natural_t, index_t*, index_t*, real_t*, bool, bool, bool> Mtx_St_NNNvNvRvBBB(const std::string& St0) {
+            return Gz_St_B(St0) ? Mtxz_St_NNNvNvRvBBB<index_t>(St0) : Mtxm_St_NNNvNvRvBBB<index_t>(St0);
+        }
+
+
+        /**
+         * @brief Prefix-sums counts in place, in parallel: Nvt0[N1 + 1] += Nvt0[N1].
+         * Every thread sums a contiguous block, the block sums are prefix-summed in order, then every thread offsets its block.
+         * 
+         * @param Nvt0 Natural vector [Nv], target [t]. Size: N0 + 1.
+         * @param N0 Natural number [N].
+         * @tparam index_t Index type.
+         */
+        template<typename index_t>
+        static void Ps_NvtN_0(index_t* Nvt0, const natural_t& N0) {
+            #ifdef _OPENMP
+            const natural_t N1 = std::max<natural_t>(1, std::min<natural_t>(static_cast<natural_t>(omp_get_max_threads()), N0 / PREFIX_BLOCK));
+            #else
+            const natural_t N1 = 1;
+            #endif
+
+            if(N1 == 1) {
+                for(natural_t N2 = 0; N2 < N0; ++N2)
+                    Nvt0[N2 + 1] += Nvt0[N2];
+
+                return;
+            }
+
+            index_t* Nv0 = new index_t[N1 + 1];
+            Nv0[0] = Nvt0[0];
+
+            #pragma omp parallel num_threads(N1)
+            {
+                #ifdef _OPENMP
+                const natural_t N2 = static_cast<natural_t>(omp_get_thread_num()), N3 = static_cast<natural_t>(omp_get_num_threads());
+                #else
+                const natural_t N2 = 0, N3 = 1;
+                #endif
+
+                // Block.
+                const natural_t N4 = 1 + N0 * N2 / N3, N5 = 1 + N0 * (N2 + 1) / N3;
+
+                for(natural_t N6 = N4 + 1; N6 < N5; ++N6)
+                    Nvt0[N6] += Nvt0[N6 - 1];
+
+                Nv0[N2 + 1] = N5 > N4 ? Nvt0[N5 - 1] : 0;
+
+                #pragma omp barrier
+
+                // Block sums.
+                #pragma omp single
+                for(natural_t N6 = 0; N6 < N3; ++N6)
+                    Nv0[N6 + 1] += Nv0[N6];
+
+                for(natural_t N6 = N4; N6 < N5; ++N6)
+                    Nvt0[N6] += Nv0[N2];
+            }
+
+            delete[] Nv0;
+        }
+
+
+        /**
+         * @brief Compressed pointers from sorted coordinates.
+         * 
+         * @param Nvt0 Natural vector [Nv], target [t]. Size: N0 + 1.
+         * @param Nv0 Natural vector [Nv], sorted coordinates.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], entries.
+         * @tparam index_t Index type, pointers.
+         * @tparam coordinate_t Index type, coordinates.
+         */
+        template<typename index_t, typename coordinate_t>
+        static void Pt_NvtNvNN_0(index_t* Nvt0, const coordinate_t* Nv0, const natural_t& N0, const natural_t& N1) {
+            if(N1 == 0) {
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N0 + 1; ++N2)
+                    Nvt0[N2] = 0;
+
+                return;
+            }
+
+            for(natural_t N2 = 0; N2 <= Nv0[0]; ++N2)
+                Nvt0[N2] = 0;
+
+            #pragma omp parallel for
+            for(natural_t N2 = 1; N2 < N1; ++N2)
+                for(natural_t N3 = Nv0[N2 - 1] + 1; N3 <= Nv0[N2]; ++N3)
+                    Nvt0[N3] = static_cast<index_t>(N2);
+
+            for(natural_t N2 = Nv0[N1 - 1] + 1; N2 < N0 + 1; ++N2)
+                Nvt0[N2] = static_cast<index_t>(N1);
+        }
+
+
+        /**
+         * @brief Loads a sparse matrix from a file, reading it once, in the requested (CSC) and/or (CSR) layouts.
+         * Sorted entries are compressed directly, unsorted ones go through Cmp_NNNvNvRv_NvNvRv, the other layout is obtained by transposition.
+         * Layouts which are not requested are returned as nullptr.
+         * Indices are parsed and compressed as index_t, which must fit the size and the stored entries, see Nrw_NN_B and Sz_St_NN.
+         * Symmetric files are expanded, their off-diagonal entries twice, and fail the load before the expansion when these do not fit index_t.
+         * 
+         * @param St0 String [St].
+         * @param B0 Boolean [B], (CSC).
+         * @param B1 Boolean [B], (CSR).
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, index_t*, index_t*, real_t*, index_t*, index_t*, real_t*> (CSC) and (CSR) sparse matrices [Spc, Spr].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*, index_t*, index_t*, real_t*> Spcr_StBB_NNvNvRvNvNvRv(const std::string& St0, const bool& B0, const bool& B1) {
+            const auto [N0, N1, Nv0, Nv1, Rv0, B2, B3, B4] = Mtx_St_NNNvNvRvBBB<index_t>(St0);
+
+            index_t* Nv2 = nullptr; index_t* Nv3 = nullptr; real_t* Rv1 = nullptr; // (CSC).
+            index_t* Nv4 = nullptr; index_t* Nv5 = nullptr; real_t* Rv2 = nullptr; // (CSR).
+
+            if(B4) { // Symmetric, expanded.
+                natural_t N2 = N1;
+
+                #pragma omp parallel for reduction(+: N2)
+                for(natural_t N3 = 0; N3 < N1; ++N3)
+                    N2 += Nv0[N3] != Nv1[N3];
+
+                if(N2 > std::numeric_limits<index_t>::max())
+                    Err_StStSt_0("symmetric expansion", St0, std::to_string(N2) + " entries, past the index type");
+
+                index_t* Nv6 = new index_t[2 * N1];
+                index_t* Nv7 = new index_t[2 * N1];
+                real_t* Rv3 = new real_t[2 * N1];
+
+                // Mirrored entries, diagonal ones are mirrored as zeros and summed back.
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N1; ++N2) {
+                    Nv6[2 * N2] = Nv0[N2]; Nv7[2 * N2] = Nv1[N2]; Rv3[2 * N2] = Rv0[N2];
+                    Nv6[2 * N2 + 1] = Nv1[N2]; Nv7[2 * N2 + 1] = Nv0[N2]; Rv3[2 * N2 + 1] = Nv0[N2] == Nv1[N2] ? 0.0 : Rv0[N2];
+                }
+
+                std::tie(Nv2, Nv3, Rv1) = Cmp_NNNvNvRv_NvNvRv(N0, 2 * N1, Nv6, Nv7, Rv3);
+
+                delete[] Nv0; delete[] Nv1; delete[] Rv0;
+                delete[] Nv6; delete[] Nv7; delete[] Rv3;
+            } else if(B2) { // Sorted by column.
+                Nv2 = new index_t[N0 + 1];
+                Pt_NvtNvNN_0(Nv2, Nv1, N0, N1);
+
+                Nv3 = Nv0;
+                Rv1 = Rv0;
+
+                delete[] Nv1;
+            } else if(B3) { // Sorted by row.
+                Nv4 = new index_t[N0 + 1];
+                Pt_NvtNvNN_0(Nv4, Nv0, N0, N1);
+
+                Nv5 = Nv1;
+                Rv2 = Rv0;
+
+                delete[] Nv0;
+            } else { // Unsorted, possibly repeated, entries.
+                std::tie(Nv2, Nv3, Rv1) = Cmp_NNNvNvRv_NvNvRv(N0, N1, Nv0, Nv1, Rv0);
+
+                delete[] Nv0; delete[] Nv1; delete[] Rv0;
+            }
+
+            // Other layout.
+            if(Nv2 != nullptr && B1)
+                std::tie(Nv4, Nv5, Rv2) = Tr_NNvNvRv_NvNvRv(N0, Nv2, Nv3, Rv1);
+
+            if(Nv4 != nullptr && B0 && Nv2 == nullptr)
+                std::tie(Nv2, Nv3, Rv1) = Tr_NNvNvRv_NvNvRv(N0, Nv4, Nv5, Rv2);
+
+            if(!B0) {
+                delete[] Nv2; delete[] Nv3; delete[] Rv1;
+                Nv2 = nullptr; Nv3 = nullptr; Rv1 = nullptr;
+            }
+
+            if(!B1) {
+                delete[] Nv4; delete[] Nv5; delete[] Rv2;
+                Nv4 = nullptr; Nv5 = nullptr; Rv2 = nullptr;
+            }
+
+            return {N0, Nv2, Nv3, Rv1, Nv4, Nv5, Rv2};
+        }
+
+
+        /**
+         * @brief Compresses (COO) entries in any order into a (CSC) sparse matrix, summing repeated entries.
+         * Sorts by (column, row) with a parallel (LSD) radix sort, on the row digits and then on the column ones, then sums repeated entries while emitting the (CSC) arrays.
+         * Rows and columns are sorted as separate keys, so that no combined key can overflow.
+         * 
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], entries.
+         * @param Nv0 Natural vector [Nv], rows.
+         * @param Nv1 Natural vector [Nv], columns.
+         * @param Rv0 Real vector [Rv].
+         * @tparam index_t Index type, also the sorting keys.
+         * @return std::tuple<index_t*, index_t*, real_t*> (CSC) sparse matrix [Spc].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<index_t*, index_t*, real_t*> Cmp_NNNvNvRv_NvNvRv(const natural_t& N0, const natural_t& N1, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0) {
+            #ifdef _OPENMP
+            const natural_t N2 = static_cast<natural_t>(omp_get_max_threads());
+            #else
+            const natural_t N2 = 1;
+            #endif
+
+            // Keys and buffers, rows and columns.
+            index_t* Nv2 = new index_t[N1];
+            index_t* Nv3 = new index_t[N1];
+            index_t* Nv8 = new index_t[N1];
+            index_t* Nv9 = new index_t[N1];
+            real_t* Rv1 = new real_t[N1];
+            real_t* Rv2 = new real_t[N1];
+
+            #pragma omp parallel for
+            for(natural_t N3 = 0; N3 < N1; ++N3) {
+                Nv2[N3] = Nv0[N3];
+                Nv8[N3] = Nv1[N3];
+                Rv1[N3] = Rv0[N3];
+            }
+
+            // Digits, per key.
+            natural_t N3 = 0;
+
+            for(natural_t N4 = N0 > 0 ? N0 - 1 : 0; N4 > 0; N4 >>= RADIX_BITS)
+                ++N3;
+
+            // Histograms, per thread.
+            natural_t* Nv4 = new natural_t[N2 * RADIX_SIZE];
+
+            for(natural_t N4 = 0; N4 < 2 * N3; ++N4) {
+                const natural_t N5 = (N4 % N3) * RADIX_BITS;
+                const index_t* Nv10 = N4 < N3 ? Nv2 : Nv8;
+                bool B0 = false;
+
+                #pragma omp parallel num_threads(N2)
+                {
+                    #ifdef _OPENMP
+                    const natural_t N6 = static_cast<natural_t>(omp_get_thread_num());
+                    #else
+                    const natural_t N6 = 0;
+                    #endif
+
+                    const natural_t N7 = N1 * N6 / N2, N8 = N1 * (N6 + 1) / N2;
+                    natural_t* Nv5 = Nv4 + N6 * RADIX_SIZE;
+
+                    // Count.
+                    for(natural_t N9 = 0; N9 < RADIX_SIZE; ++N9)
+                        Nv5[N9] = 0;
+
+                    for(natural_t N9 = N7; N9 < N8; ++N9)
+                        ++Nv5[(static_cast<natural_t>(Nv10[N9]) >> N5) & (RADIX_SIZE - 1)];
+
+                    #pragma omp barrier
+
+                    // Offsets, bucket-major then thread-major for stability.
+                    #pragma omp single
+                    {
+                        natural_t N9 = 0;
+
+                        for(natural_t N10 = 0; N10 < RADIX_SIZE; ++N10) {
+                            const natural_t N11 = N9;
+
+                            for(natural_t N12 = 0; N12 < N2; ++N12) {
+                                const natural_t N13 = Nv4[N12 * RADIX_SIZE + N10];
+
+                                Nv4[N12 * RADIX_SIZE + N10] = N9;
+                                N9 += N13;
+                            }
+
+                            // Constant digit, the global bucket holds every entry and the pass is skipped.
+                            if(N9 - N11 == N1)
+                                B0 = true;
+                        }
+                    }
+
+                    // Scatter.
+                    if(!B0)
+                        for(natural_t N9 = N7; N9 < N8; ++N9) {
+                            const natural_t N10 = Nv5[(static_cast<natural_t>(Nv10[N9]) >> N5) & (RADIX_SIZE - 1)]++;
+
+                            Nv3[N10] = Nv2[N9];
+                            Nv9[N10] = Nv8[N9];
+                            Rv2[N10] = Rv1[N9];
+                        }
+                }
+
+                if(!B0) {
+                    std::swap(Nv2, Nv3);
+                    std::swap(Nv8, Nv9);
+                    std::swap(Rv1, Rv2);
+                }
+            }
+
+            delete[] Nv4;
+
+            // Repeated entries, per thread.
+            natural_t* Nv5 = new natural_t[N2 + 1];
+            Nv5[0] = 0;
+
+            #pragma omp parallel for num_threads(N2)
+            for(natural_t N4 = 0; N4 < N2; ++N4) {
+                natural_t N5 = 0;
+
+                for(natural_t N6 = N1 * N4 / N2; N6 < N1 * (N4 + 1) / N2; ++N6)
+                    if(N6 == 0 || Nv2[N6] != Nv2[N6 - 1] || Nv8[N6] != Nv8[N6 - 1])
+                        ++N5;
+
+                Nv5[N4 + 1] = N5;
+            }
+
+            for(natural_t N4 = 0; N4 < N2; ++N4)
+                Nv5[N4 + 1] += Nv5[N4];
+
+            // Emission, each run is summed by the thread owning its first entry.
+            const natural_t N4 = Nv5[N2];
+
+            index_t* Nv6 = new index_t[N0 + 1];
+            index_t* Nv7 = new index_t[N4];
+            real_t* Rv3 = new real_t[N4];
+
+            #pragma omp parallel for num_threads(N2)
+            for(natural_t N5 = 0; N5 < N2; ++N5) {
+                natural_t N6 = Nv5[N5];
+
+                for(natural_t N7 = N1 * N5 / N2; N7 < N1 * (N5 + 1) / N2; ++N7) {
+                    if(N7 > 0 && Nv2[N7] == Nv2[N7 - 1] && Nv8[N7] == Nv8[N7 - 1])
+                        continue;
+
+                    real_t R0 = Rv1[N7];
+
+                    for(natural_t N8 = N7 + 1; N8 < N1 && Nv2[N8] == Nv2[N7] && Nv8[N8] == Nv8[N7]; ++N8)
+                        R0 += Rv1[N8];
+
+                    Nv7[N6] = Nv2[N7];
+                    Rv3[N6] = R0;
+
+                    // Columns, kept for the pointers.
+                    Nv3[N6] = Nv8[N7];
+
+                    ++N6;
+                }
+            }
+
+            // Pointers.
+            Pt_NvtNvNN_0(Nv6, Nv3, N0, N4);
+
+            delete[] Nv2; delete[] Nv3;
+            delete[] Nv8; delete[] Nv9;
+            delete[] Rv1; delete[] Rv2;
+            delete[] Nv5;
+
+            return {Nv6, Nv7, Rv3};
+        }
+
+
+        /**
+         * @brief Loads a (CSC) sparse matrix from a file.
+         * 
+         * @param St String [St]
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, index_t*, index_t*, real_t*> (CSC) sparse matrix [Spc].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*> Spc_St_NNvNvRv(const std::string& St0) {
+            const auto [N0, Nv0, Nv1, Rv0, Nv2, Nv3, Rv1] = Spcr_StBB_NNvNvRvNvNvRv<index_t>(St0, true, false);
+
+            return {N0, Nv0, Nv1, Rv0};
+        }
+
+
+        /**
+         * @brief Loads a (CSR) sparse matrix from a file.
+         * 
+         * @param St String [St]
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, index_t*, index_t*, real_t*> (CSR) sparse matrix [Spr].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*> Spr_St_NNvNvRv(const std::string& St0) {
+            const auto [N0, Nv0, Nv1, Rv0, Nv2, Nv3, Rv1] = Spcr_StBB_NNvNvRvNvNvRv<index_t>(St0, false, true);
+
+            return {N0, Nv2, Nv3, Rv1};
+        }
+
+
+        /**
+         * @brief Loads a symmetric sparse matrix from a file, storing its lower triangle only as a (CSC) sparse matrix.
+         * Upper entries are moved to the lower triangle, files not declared symmetric fail the load.
+         * 
+         * @param St0 String [St].
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, index_t*, index_t*, real_t*> (CSC) lower sparse matrix [Sps].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, index_t*, index_t*, real_t*> Sps_St_NNvNvRv(const std::string& St0) {
+            const auto [N0, N1, Nv0, Nv1, Rv0, B0, B1, B2] = Mtx_St_NNNvNvRvBBB<index_t>(St0);
+
+            // Symmetry check.
+            if(!B2)
+                Err_StStSt_0("symmetric loading", St0, "the matrix is not stored as symmetric");
+
+            // Lower check.
+            bool B3 = true;
+
+            #pragma omp parallel for reduction(&&: B3)
+            for(natural_t N2 = 0; N2 < N1; ++N2)
+                B3 = B3 && Nv0[N2] >= Nv1[N2];
+
+            if(B0 && B3) { // Sorted by column.
+                index_t* Nv2 = new index_t[N0 + 1];
+                Pt_NvtNvNN_0(Nv2, Nv1, N0, N1);
+
+                delete[] Nv1;
+
+                return {N0, Nv2, Nv0, Rv0};
+            }
+
+            // Lower coordinates.
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N1; ++N2)
+                if(Nv0[N2] < Nv1[N2])
+                    std::swap(Nv0[N2], Nv1[N2]);
+
+            const auto [Nv2, Nv3, Rv1] = Cmp_NNNvNvRv_NvNvRv(N0, N1, Nv0, Nv1, Rv0);
+
+            delete[] Nv0; delete[] Nv1; delete[] Rv0;
+
+            return {N0, Nv2, Nv3, Rv1};
+        }
+
+
+        /**
+         * @brief Loads the entries of a (.mtx) or (.mtx.gz) file, in their original ordering.
+         * 
+         * @param St0 String [St].
+         * @return std::tuple<natural_t, natural_t, natural_t*, natural_t*, real_t*, bool> Size, entries, (COO) sparse matrix [Spo], symmetry.
+         */
+        [[nodiscard]] std::tuple<natural_t, natural_t, natural_t*, natural_t*, real_t*, bool> Coo_St_NNNvNvRvB(const std::string& St0) {
+            const auto [N0, N1, Nv0, Nv1, Rv0, B0, B1, B2] = Mtx_St_NNNvNvRvBBB<natural_t>(St0);
+
+            return {N0, N1, Nv0, Nv1, Rv0, B2};
+        }
+
+
+        /**
+         * @brief Checks whether a file holds a symmetric matrix.
+         * 
+         * @param St0 String [St].
+         * @return bool Boolean [B].
+         */
+        [[nodiscard]] bool Sym_St_B(const std::string& St0) {
+            if(Gz_St_B(St0)) {
+                char Cv0[STREAM_BANNER] = {};
+                gzFile F0 = gzopen(St0.c_str(), "rb");
+
+                if(F0 == nullptr)
+                    return false;
+
+                const bool B0 = gzgets(F0, Cv0, STREAM_BANNER) != nullptr && Sym_CvN_B(Cv0, std::strlen(Cv0));
+                gzclose(F0);
+
+                return B0;
+            }
+
+            const auto [C0, N0] = Mm_St_CvN(St0);
+            const bool B0 = Sym_CvN_B(C0, N0);
+
+            munmap(const_cast<char*>(C0), N0);
+
+            return B0;
+        }
+
+
+        /**
+         * @brief Reads the size and the number of entries from the header of a file, without loading it.
+         * 
+         * @param St0 String [St].
+         * @return std::tuple<natural_t, natural_t> Size, entries.
+         */
+        [[nodiscard]] std::tuple<natural_t, natural_t> Sz_St_NN(const std::string& St0) {
+            natural_t N0 = 0, N1 = 0, N2 = 0;
+
+            if(Gz_St_B(St0)) {
+                char Cv0[STREAM_BANNER] = {};
+                gzFile F0 = gzopen(St0.c_str(), "rb");
+
+                if(F0 == nullptr)
+                    Err_StSt_0("gzopen", St0);
+
+                // Skips, comment lines may span several reads.
+                bool B0 = true;
+
+                while(gzgets(F0, Cv0, STREAM_BANNER) != nullptr) {
+                    const natural_t N3 = std::strlen(Cv0);
+
+                    if(B0 && Cv0[0] != '%') {
+                        Hd_CCNtNtNt_C(Cv0, Cv0 + N3, N0, N1, N2);
+                        break;
+                    }
+
+                    B0 = N3 > 0 && Cv0[N3 - 1] == '\n';
+                }
+
+                gzclose(F0);
+
+                return {N0, N2};
+            }
+
+            const auto [C0, N3] = Mm_St_CvN(St0);
+            Hd_CCNtNtNt_C(C0, C0 + N3, N0, N1, N2);
+
+            munmap(const_cast<char*>(C0), N3);
+
+            return {N0, N2};
+        }
+
+
+        /**
+         * @brief Checks whether a sparse matrix can be indexed with natural32_t.
+         * 
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], entries.
+         * @return bool Boolean [B].
+         */
+        [[nodiscard]] bool Nrw_NN_B(const natural_t& N0, const natural_t& N1) {
+            return N0 <= std::numeric_limits<natural32_t>::max() && N1 <= std::numeric_limits<natural32_t>::max();
+        }
+
+
+        /**
+         * @brief Narrows a natural_t* into an index_t*.
+         * 
+         * @param Nv0 Natural vector [Nv].
+         * @param N0 Natural number [N].
+         * @tparam index_t Index type.
+         * @return index_t* Natural vector [Nv].
+         */
+        template<typename index_t>
+        [[nodiscard]] index_t* Nrw_NvN_Nv(const natural_t* Nv0, const natural_t& N0) {
+            index_t* Nv1 = new index_t[N0];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Nv1[N1] = static_cast<index_t>(Nv0[N1]);
+
+            return Nv1;
+        }
+
+
+        /**
+         * @brief Narrows a real_t* into a value_t*.
+         * 
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam value_t Value type.
+         * @return value_t* Real vector [Rv].
+         */
+        template<typename value_t>
+        [[nodiscard]] value_t* Nrw_RvN_Rv(const real_t* Rv0, const natural_t& N0) {
+            value_t* Rv1 = new value_t[N0];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Rv1[N1] = static_cast<value_t>(Rv0[N1]);
+
+            return Rv1;
+        }
+
+
+        /**
+         * @brief Builds the numeric pattern of a (CSC) sparse matrix: for every stored entry, the (COO) entries summing into it.
+         * Symmetric entries are either mirrored, for the expanded storage, or moved to the lower triangle, for the half storage.
+         * The pattern of a (CSR) sparse matrix is obtained by swapping rows and columns.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within columns.
+         * @param N1 Natural number [N], (COO) entries.
+         * @param Nv2 Natural vector [Nv], (COO) rows.
+         * @param Nv3 Natural vector [Nv], (COO) columns.
+         * @param B0 Boolean [B], symmetric entries.
+         * @param B1 Boolean [B], symmetric (lower) storage.
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t*, natural_t*> Pointers and (COO) entries [Ptn].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t*, natural_t*> Ptn_NNvNvNNvNvBB_NvNv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3, const bool& B0, const bool& B1) {
+            const natural_t N2 = Nv0[N0];
+
+            // Slots, every mirrored entry gets a second one.
+            const bool B2 = B0 && !B1;
+            const natural_t N3 = B2 ? 2 * N1 : N1;
+
+            natural_t* Nv4 = new natural_t[N3];
+
+            // Positions, diagonal mirrors are discarded.
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N3; ++N4) {
+                const natural_t N5 = B2 ? N4 / 2 : N4;
+                natural_t N6 = Nv2[N5], N7 = Nv3[N5];
+
+                if(B2 && (N4 % 2 == 1)) {
+                    if(N6 == N7) {
+                        Nv4[N4] = N2;
+                        continue;
+                    }
+
+                    std::swap(N6, N7);
+                }
+
+                if(B0 && B1 && N6 < N7)
+                    std::swap(N6, N7);
+
+                const index_t* Nv5 = std::lower_bound(Nv1 + Nv0[N7], Nv1 + Nv0[N7 + 1], static_cast<index_t>(N6));
+
+                #ifndef NDEBUG // Integrity check.
+                assert(Nv5 != Nv1 + Nv0[N7 + 1] && *Nv5 == N6);
+                #endif
+
+                Nv4[N4] = static_cast<natural_t>(Nv5 - Nv1);
+            }
+
+            // Counting sort by position, in parallel, then every position is sorted back into the original ordering.
+            natural_t* Nv6 = new natural_t[N2 + 1]();
+
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N3; ++N4)
+                if(Nv4[N4] < N2) {
+                    #pragma omp atomic
+                    ++Nv6[Nv4[N4] + 1];
+                }
+
+            Ps_NvtN_0(Nv6, N2);
+
+            natural_t* Nv7 = new natural_t[Nv6[N2]];
+            natural_t* Nv8 = new natural_t[N2];
+
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N2; ++N4)
+                Nv8[N4] = Nv6[N4];
+
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N3; ++N4)
+                if(Nv4[N4] < N2) {
+                    natural_t N5;
+
+                    #pragma omp atomic capture
+                    N5 = Nv8[Nv4[N4]]++;
+
+                    Nv7[N5] = B2 ? N4 / 2 : N4;
+                }
+
+            #pragma omp parallel for schedule(dynamic, 4096)
+            for(natural_t N4 = 0; N4 < N2; ++N4)
+                if(Nv6[N4 + 1] - Nv6[N4] > 1)
+                    std::sort(Nv7 + Nv6[N4], Nv7 + Nv6[N4 + 1]);
+
+            delete[] Nv4;
+            delete[] Nv8;
+
+            return {Nv6, Nv7};
+        }
+
+
+        /**
+         * @brief Refreshes the values of a sparse matrix from (COO) values in their original ordering, keeping its structure.
+         * Every stored entry gathers, in parallel, the sum of its (COO) entries.
+         * With a pattern from Ptt_NvN_NvNv, refreshes a derived layout from the values of its sparse matrix.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N], stored entries.
+         * @param Nv0 Natural vector [Nv], from Ptn_NNvNvNNvNvBB_NvNv or Ptt_NvN_NvNv.
+         * @param Nv1 Natural vector [Nv], from Ptn_NNvNvNNvNvBB_NvNv or Ptt_NvN_NvNv.
+         * @param Rv0 Real vector [Rv], (COO) values or values of the sparse matrix.
+         * @tparam value_t Value type.
+         */
+        template<typename value_t>
+        void Rfs_RvtNNvNvRv_0(value_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0) {
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                real_t R0 = 0.0;
+
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
+                    R0 += Rv0[Nv1[N2]];
+
+                Rvt0[N1] = static_cast<value_t>(R0);
+            }
+        }
+
+
+        /**
+         * @brief Tags, every stored entry holding its one-based position, exactly, in a natural vector.
+         * A layout built from a sparse matrix on its tags holds, in every slot, the position its value is copied from, or zero for padding.
+         * 
+         * @param N0 Natural number [N], stored entries.
+         * @return natural_t* Natural vector [Nv].
+         */
+        [[nodiscard]] natural_t* Tg_N_Nv(const natural_t& N0) {
+            natural_t* Nv0 = new natural_t[N0];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Nv0[N1] = N1 + 1;
+
+            return Nv0;
+        }
+
+
+        /**
+         * @brief Builds the numeric pattern of a layout from its values as built on Tg_N_Nv tags: for every slot, the stored entry it copies, none for padding.
+         * The layout is then refreshed from its sparse matrix by Rfs_RvtNNvNvRv_0, and layouts derived from it are chained the same way.
+         * 
+         * @param Nv0 Natural vector [Nv], tagged values.
+         * @param N0 Natural number [N], slots.
+         * @return std::tuple<natural_t*, natural_t*> Pointers and stored entries [Ptn].
+         */
+        [[nodiscard]] std::tuple<natural_t*, natural_t*> Ptt_NvN_NvNv(const natural_t* Nv0, const natural_t& N0) {
+            natural_t* Nv1 = new natural_t[N0 + 1];
+            Nv1[0] = 0;
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Nv1[N1 + 1] = Nv0[N1] > 0 ? 1 : 0;
+
+            Ps_NvtN_0(Nv1, N0);
+
+            natural_t* Nv2 = new natural_t[Nv1[N0]];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                if(Nv1[N1 + 1] > Nv1[N1])
+                    Nv2[Nv1[N1]] = Nv0[N1] - 1;
+
+            return {Nv1, Nv2};
+        }
+
+
+        /**
+         * @brief Builds a layout derived from a sparse matrix, or from one of its derived layouts, on tags and keeps the pattern of its values.
+         * Tags go through every derivation, so that the pattern always points into the values of the sparse matrix.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], the values of the layout.
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv], the structure the layout is built from.
+         * @param Nv1 Natural vector [Nv], the structure the layout is built from.
+         * @param D0 Derived layout [D] the structure belongs to, or nullptr for the sparse matrix.
+         * @param L0 Layout [L].
+         * @param N1 Natural number [N], block size for layout_t::bcsr.
+         * @param Nv2 Natural vector [Nv], permutation for layout_t::permuted.
+         * @param B0 Boolean [B], symmetric (lower) storage for layout_t::permuted.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type.
+         * @return derived_t Derived layout [D], released by Cld_Dv_0.
+         */
+        template<typename index_t, typename value_t>
+        [[nodiscard]] derived_t Drv_RvNNvNvDLNNvB_D(value_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const derived_t* D0, const layout_t& L0, const natural_t& N1, const natural_t* Nv2, const bool& B0) {
+            const natural_t N2 = Nv0[N0];
+
+            // Tags, of the sparse matrix or recovered from the pattern of the layout.
+            natural_t* Nv3 = D0 == nullptr ? Tg_N_Nv(N2) : new natural_t[N2];
+
+            if(D0 != nullptr) {
+                #pragma omp parallel for
+                for(natural_t N3 = 0; N3 < N2; ++N3)
+                    Nv3[N3] = D0->Nv0[N3 + 1] > D0->Nv0[N3] ? D0->Nv1[D0->Nv0[N3]] + 1 : 0;
+            }
+
+            // Layout, on tags.
+            natural_t N3 = N2;
+            natural_t* Nv4 = nullptr;
+
+            switch(L0) {
+                case layout_t::permuted: {
+                    const auto [Nv5, Nv6, Nv7] = Prm_NNvNvRvNvB_NvNvRv(N0, Nv0, Nv1, Nv3, Nv2, B0);
+                    delete[] Nv5; delete[] Nv6;
+                    Nv4 = Nv7;
+                    break;
+                }
+                case layout_t::csr: {
+                    const auto [Nv5, Nv6, Nv7] = Tr_NNvNvRv_NvNvRv(N0, Nv0, Nv1, Nv3);
+                    delete[] Nv5; delete[] Nv6;
+                    Nv4 = Nv7;
+                    break;
+                }
+                case layout_t::sell: {
+                    const auto [Nv5, Nv6, Nv7, Nv8] = Sel_NNvNvRv_NvNvNvRv(N0, Nv0, Nv1, Nv3);
+                    N3 = Nv6[(N0 + sell_chunk - 1) / sell_chunk];
+                    delete[] Nv5; delete[] Nv6; delete[] Nv7;
+                    Nv4 = Nv8;
+                    break;
+                }
+                case layout_t::bcsr: {
+                    const auto [Nv5, Nv6, Nv7] = Bcr_NNNvNvRv_NvNvRv(N0, N1, Nv0, Nv1, Nv3);
+                    N3 = Nv5[N0 / N1] * N1 * N1;
+                    delete[] Nv5; delete[] Nv6;
+                    Nv4 = Nv7;
+                    break;
+                }
+                case layout_t::dia: {
+                    const auto [N4, Iv0, Nv5] = Dia_NNvNvRv_NIvRv(N0, Nv0, Nv1, Nv3);
+                    N3 = N4 * N0;
+                    delete[] Iv0;
+                    Nv4 = Nv5;
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            const auto [Nv5, Nv6] = Ptt_NvN_NvNv(Nv4 != nullptr ? Nv4 : Nv3, N3);
+
+            delete[] Nv3;
+            delete[] Nv4;
+
+            derived_t D1{nullptr, nullptr, N3, Nv5, Nv6};
+
+            if constexpr(std::is_same_v<value_t, real_t>)
+                D1.Rv0 = Rvt0;
+            else
+                D1.Rv1 = Rvt0;
+
+            return D1;
+        }
+
+
+        /**
+         * @brief Refreshes every derived layout from the values of its sparse matrix, see Drv_RvNNvNvDLNNvB_D.
+         * 
+         * @param Dv0 Derived layouts [Dv].
+         * @param Rv0 Real vector [Rv], values of the sparse matrix.
+         */
+        void Rfd_DvRv_0(const std::vector<derived_t>& Dv0, const real_t* Rv0) {
+            for(const derived_t& D0: Dv0)
+                if(D0.Rv0 != nullptr)
+                    Rfs_RvtNNvNvRv_0(D0.Rv0, D0.N0, D0.Nv0, D0.Nv1, Rv0);
+                else
+                    Rfs_RvtNNvNvRv_0(D0.Rv1, D0.N0, D0.Nv0, D0.Nv1, Rv0);
+        }
+
+
+        /**
+         * @brief Releases the patterns of derived layouts, not their values.
+         * 
+         * @param Dv0 Derived layouts [Dv].
+         */
+        void Cld_Dv_0(std::vector<derived_t>& Dv0) {
+            for(derived_t& D0: Dv0) {
+                delete[] D0.Nv0;
+                delete[] D0.Nv1;
+            }
+
+            Dv0.clear();
+        }
+
+
+        /**
+         * @brief Length of the varint encoding of a natural_t.
+         * 
+         * @param N0 Natural number [N].
+         * @return natural_t Natural number [N].
+         */
+        static inline natural_t Vl_N_N(natural_t N0) {
+            natural_t N1 = 1;
+
+            for(; N0 >= 0x80; N0 >>= 7)
+                ++N1;
+
+            return N1;
+        }
+
+
+        /**
+         * @brief Writes the varint encoding of a natural_t.
+         * 
+         * @param Cv0 Byte vector [Cv].
+         * @param N0 Natural number [N].
+         * @return unsigned char* Byte vector [Cv], past the encoding.
+         */
+        static inline unsigned char* Vw_CvN_Cv(unsigned char* Cv0, natural_t N0) {
+            for(; N0 >= 0x80; N0 >>= 7)
+                *Cv0++ = static_cast<unsigned char>(N0 | 0x80);
+
+            *Cv0++ = static_cast<unsigned char>(N0);
+
+            return Cv0;
+        }
+
+
+        /**
+         * @brief Reads a varint-encoded natural_t, advancing the cursor.
+         * 
+         * @param Cv0 Byte vector [Cv].
+         * @return natural_t Natural number [N].
+         */
+        static inline natural_t Vr_Cv_N(const unsigned char*& Cv0) {
+            const natural_t N0 = Cv0[0];
+
+            if(N0 < 0x80) [[likely]] {
+                Cv0 += 1;
+                return N0;
+            }
+
+            const natural_t N1 = Cv0[1];
+
+            if(N1 < 0x80) [[likely]] {
+                Cv0 += 2;
+                return (N0 & 0x7F) | (N1 << 7);
+            }
+
+            natural_t N2 = (N0 & 0x7F) | ((N1 & 0x7F) << 7);
+            Cv0 += 2;
+
+            for(unsigned int I0 = 14;; I0 += 7) {
+                const natural_t N3 = *Cv0++;
+                N2 |= (N3 & 0x7F) << I0;
+
+                if(N3 < 0x80)
+                    return N2;
+            }
+        }
+
+
+        /**
+         * @brief Column-relative first index, zigzag-encoded.
+         * 
+         * @param N0 Natural number [N], row.
+         * @param N1 Natural number [N], column.
+         * @return natural_t Natural number [N].
+         */
+        static inline natural_t Zz_NN_N(const natural_t& N0, const natural_t& N1) {
+            return N0 >= N1 ? (N0 - N1) << 1 : ((N1 - N0) << 1) - 1;
+        }
+
+
+        /**
+         * @brief Inverse of Zz_NN_N.
+         * 
+         * @param N0 Natural number [N], code.
+         * @param N1 Natural number [N], column.
+         * @return natural_t Natural number [N], row.
+         */
+        static inline natural_t Uz_NN_N(const natural_t& N0, const natural_t& N1) {
+            return (N0 & 1) ? N1 - ((N0 + 1) >> 1) : N1 + (N0 >> 1);
+        }
+
+
+        /**
+         * @brief Delta-encodes the row indices of a (CSC) sparse matrix.
+         * Each column stores its first row relative to the diagonal, zigzag-encoded, then the gaps between consecutive rows, all as byte-aligned varints.
+         * Columns are consecutive, the encoding is meant to be streamed by Mlc_RvtNNvCvRvRv_0 and Mls_RvtNNvCvRvRv_0.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within columns.
+         * @tparam index_t Index type.
+         * @return std::tuple<unsigned char*, natural_t> Byte vector [Cv], size.
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<unsigned char*, natural_t> Dlt_NNvNv_CvN(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            natural_t* Nv2 = new natural_t[N0 + 1];
+            Nv2[0] = 0;
+
+            // Sizes.
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                natural_t N2 = 0;
+
+                for(natural_t N3 = Nv0[N1]; N3 < Nv0[N1 + 1]; ++N3) {
+
+                    #ifndef NDEBUG // Integrity check.
+                    assert(N3 == Nv0[N1] || Nv1[N3] >= Nv1[N3 - 1]);
+                    #endif
+
+                    N2 += Vl_N_N(N3 == Nv0[N1] ? Zz_NN_N(Nv1[N3], N1) : Nv1[N3] - Nv1[N3 - 1]);
+                }
+
+                Nv2[N1 + 1] = N2;
+            }
+
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Nv2[N1 + 1] += Nv2[N1];
+
+            // Encoding.
+            unsigned char* Cv0 = new unsigned char[Nv2[N0] + 1];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                unsigned char* Cv1 = Cv0 + Nv2[N1];
+
+                for(natural_t N3 = Nv0[N1]; N3 < Nv0[N1 + 1]; ++N3)
+                    Cv1 = Vw_CvN_Cv(Cv1, N3 == Nv0[N1] ? Zz_NN_N(Nv1[N3], N1) : Nv1[N3] - Nv1[N3 - 1]);
+            }
+
+            const natural_t N1 = Nv2[N0];
+            delete[] Nv2;
+
+            return {Cv0, N1};
+        }
+
+
+        /**
+         * @brief Transposes a (CSC) sparse matrix into a (CSR) one, or vice versa.
+         * Every thread counts the entries of a contiguous range of segments, the counts are prefix-summed across threads and segments, then every thread scatters its range.
+         * Ranges being scattered in order, every transposed segment is sorted and the output is deterministic.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type.
+         * @return std::tuple<index_t*, index_t*, value_t*> Transposed sparse matrix.
+         */
+        template<typename index_t, typename value_t>
+        [[nodiscard]] std::tuple<index_t*, index_t*, value_t*> Tr_NNvNvRv_NvNvRv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0) {
+            const natural_t N1 = Nv0[N0];
+
+            // Threads, private counts bounded by the entries.
+            #ifdef _OPENMP
+            const natural_t N2 = std::max<natural_t>(1, std::min<natural_t>(static_cast<natural_t>(omp_get_max_threads()), N1 / (N0 + 1)));
+            #else
+            const natural_t N2 = 1;
+            #endif
+
+            index_t* Nv2 = new index_t[N0 + 1];
+            index_t* Nv3 = new index_t[N1];
+            value_t* Rv1 = new value_t[N1];
+
+            // Private counts, then cursors.
+            index_t* Nv4 = new index_t[N2 * N0]();
+
+            #pragma omp parallel num_threads(N2)
+            {
+                #ifdef _OPENMP
+                const natural_t N3 = static_cast<natural_t>(omp_get_thread_num());
+                #else
+                const natural_t N3 = 0;
+                #endif
+
+                // Range.
+                const natural_t N4 = N3 * N0 / N2, N5 = (N3 + 1) * N0 / N2;
+                index_t* Nv5 = Nv4 + N3 * N0;
+
+                // Count.
+                for(natural_t N6 = Nv0[N4]; N6 < Nv0[N5]; ++N6)
+                    ++Nv5[Nv1[N6]];
+
+                #pragma omp barrier
+
+                // Segment sizes, cursors relative to their segment.
+                #pragma omp for
+                for(natural_t N6 = 0; N6 < N0; ++N6) {
+                    index_t N7 = 0;
+
+                    for(natural_t N8 = 0; N8 < N2; ++N8) {
+                        const index_t N9 = Nv4[N8 * N0 + N6];
+
+                        Nv4[N8 * N0 + N6] = N7;
+                        N7 += N9;
+                    }
+
+                    Nv2[N6 + 1] = N7;
+                }
+
+                // Prefix-sum.
+                #pragma omp single
+                {
+                    Nv2[0] = 0;
+
+                    for(natural_t N6 = 0; N6 < N0; ++N6)
+                        Nv2[N6 + 1] += Nv2[N6];
+                }
+
+                // Scatter.
+                for(natural_t N6 = N4; N6 < N5; ++N6)
+                    for(natural_t N7 = Nv0[N6]; N7 < Nv0[N6 + 1]; ++N7) {
+                        const natural_t N8 = Nv2[Nv1[N7]] + Nv5[Nv1[N7]]++;
+
+                        Nv3[N8] = static_cast<index_t>(N6);
+                        Rv1[N8] = Rv0[N7];
+                    }
+            }
+
+            delete[] Nv4;
+
+            return {Nv2, Nv3, Rv1};
+        }
+
+
+        /**
+         * @brief Builds a (SELL-C-σ) sparse matrix from a (CSC) one.
+         * Rows are sorted by decreasing length within windows of sell_sigma rows, then packed in chunks of sell_chunk rows, column-major within every chunk and padded to the longest row.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type.
+         * @return std::tuple<natural_t*, natural_t*, index_t*, value_t*> Rows, chunk pointers, columns and values [Sel].
+         */
+        template<typename index_t, typename value_t>
+        [[nodiscard]] std::tuple<natural_t*, natural_t*, index_t*, value_t*> Sel_NNvNvRv_NvNvNvRv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0) {
+            const natural_t N1 = (N0 + sell_chunk - 1) / sell_chunk;
+
+            // (CSR) sparse matrix.
+            const auto [Nv2, Nv3, Rv1] = Tr_NNvNvRv_NvNvRv(N0, Nv0, Nv1, Rv0);
+
+            // Rows, sorted by decreasing length within each window, padded with N0.
+            natural_t* Nv4 = new natural_t[N1 * sell_chunk];
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N1 * sell_chunk; ++N2)
+                Nv4[N2] = N2;
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N0; N2 += sell_sigma)
+                std::stable_sort(Nv4 + N2, Nv4 + std::min(N2 + sell_sigma, N0), [&](const natural_t& N3, const natural_t& N4) {
+                    return Nv2[N3 + 1] - Nv2[N3] > Nv2[N4 + 1] - Nv2[N4];
+                });
+
+            // Chunk pointers.
+            natural_t* Nv5 = new natural_t[N1 + 1];
+            Nv5[0] = 0;
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N1; ++N2) {
+                natural_t N3 = 0;
+
+                for(natural_t N4 = N2 * sell_chunk; N4 < (N2 + 1) * sell_chunk; ++N4)
+                    if(Nv4[N4] < N0)
+                        N3 = std::max<natural_t>(N3, Nv2[Nv4[N4] + 1] - Nv2[Nv4[N4]]);
+                    else
+                        Nv4[N4] = N0;
+
+                Nv5[N2 + 1] = N3 * sell_chunk;
+            }
+
+            for(natural_t N2 = 0; N2 < N1; ++N2)
+                Nv5[N2 + 1] += Nv5[N2];
+
+            // Packing, padding repeats the last column with a zero value.
+            index_t* Nv6 = new index_t[Nv5[N1]];
+            value_t* Rv2 = new value_t[Nv5[N1]];
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N1; ++N2) {
+                const natural_t N3 = (Nv5[N2 + 1] - Nv5[N2]) / sell_chunk;
+
+                for(natural_t N4 = 0; N4 < sell_chunk; ++N4) {
+                    const natural_t N5 = Nv4[N2 * sell_chunk + N4];
+                    const natural_t N6 = N5 < N0 ? Nv2[N5] : 0, N7 = N5 < N0 ? Nv2[N5 + 1] : 0;
+
+                    for(natural_t N8 = 0; N8 < N3; ++N8) {
+                        const natural_t N9 = Nv5[N2] + N8 * sell_chunk + N4;
+
+                        if(N6 + N8 < N7) {
+                            Nv6[N9] = Nv3[N6 + N8];
+                            Rv2[N9] = Rv1[N6 + N8];
+                        } else {
+                            Nv6[N9] = N7 > N6 ? Nv3[N7 - 1] : 0;
+                            Rv2[N9] = static_cast<value_t>(0);
+                        }
+                    }
+                }
+            }
+
+            delete[] Nv2; delete[] Nv3; delete[] Rv1;
+
+            return {Nv4, Nv5, Nv6, Rv2};
+        }
+
+
+        /**
+         * @brief Block columns of a (CSC) sparse matrix, for square blocks of size N1.
+         * 
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], block size.
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param N2 Natural number [N], block column.
+         * @param Nvt0 Natural vector [Nv], target [t], block rows.
+         * @tparam index_t Index type.
+         */
+        template<typename index_t>
+        static void Bk_NNNvNvNNvt_0(const natural_t& N0, const natural_t& N1, const index_t* Nv0, const index_t* Nv1, const natural_t& N2, std::vector<natural_t>& Nvt0) {
+            Nvt0.clear();
+
+            for(natural_t N3 = N2 * N1; N3 < std::min(N0, (N2 + 1) * N1); ++N3)
+                for(natural_t N4 = Nv0[N3]; N4 < Nv0[N3 + 1]; ++N4)
+                    Nvt0.push_back(Nv1[N4] / N1);
+
+            std::sort(Nvt0.begin(), Nvt0.end());
+            Nvt0.erase(std::unique(Nvt0.begin(), Nvt0.end()), Nvt0.end());
+        }
+
+
+        /**
+         * @brief Chooses a square block size for a sparse matrix by its fill ratio.
+         * Every size dividing N0 is scored by the bytes streamed per product, blocks are kept only when they beat the scalar layout.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @tparam index_t Index type.
+         * @return natural_t Natural number [N], block size, 1 for scalar storage.
+         */
+        template<typename index_t>
+        [[nodiscard]] natural_t Blk_NNvNv_N(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            natural_t N1 = 1;
+            real_t R0 = static_cast<real_t>(Nv0[N0]) * (sizeof(real_t) + sizeof(index_t));
+
+            for(const natural_t N2: block_sizes) {
+                if(N0 % N2 != 0)
+                    continue;
+
+                natural_t N3 = 0;
+
+                #pragma omp parallel reduction(+: N3)
+                {
+                    std::vector<natural_t> Nv2;
+
+                    #pragma omp for schedule(dynamic, 256)
+                    for(natural_t N4 = 0; N4 < N0 / N2; ++N4) {
+                        Bk_NNNvNvNNvt_0(N0, N2, Nv0, Nv1, N4, Nv2);
+                        N3 += Nv2.size();
+                    }
+                }
+
+                const real_t R1 = static_cast<real_t>(N3) * (N2 * N2 * sizeof(real_t) + sizeof(index_t));
+
+                if(R1 < R0) {
+                    N1 = N2;
+                    R0 = R1;
+                }
+            }
+
+            return N1;
+        }
+
+
+        /**
+         * @brief Builds a (BCSR) sparse matrix with square blocks of size N1 from a (CSC) one.
+         * Blocks are stored row-major, missing entries are zeros.
+         * 
+         * @param N0 Natural number [N], multiple of N1.
+         * @param N1 Natural number [N], block size.
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type.
+         * @return std::tuple<index_t*, index_t*, value_t*> (BCSR) sparse matrix [Spb].
+         */
+        template<typename index_t, typename value_t>
+        [[nodiscard]] std::tuple<index_t*, index_t*, value_t*> Bcr_NNNvNvRv_NvNvRv(const natural_t& N0, const natural_t& N1, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0) {
+            const natural_t N2 = N0 / N1;
+
+            #ifndef NDEBUG // Integrity check.
+            assert(N0 % N1 == 0);
+            #endif
+
+            // (CSR) sparse matrix.
+            const auto [Nv2, Nv3, Rv1] = Tr_NNvNvRv_NvNvRv(N0, Nv0, Nv1, Rv0);
+
+            // Block pointers.
+            index_t* Nv4 = new index_t[N2 + 1];
+            Nv4[0] = 0;
+
+            #pragma omp parallel
+            {
+                std::vector<natural_t> Nv5;
+
+                #pragma omp for schedule(dynamic, 256)
+                for(natural_t N3 = 0; N3 < N2; ++N3) {
+                    Bk_NNNvNvNNvt_0(N0, N1, Nv2, Nv3, N3, Nv5);
+                    Nv4[N3 + 1] = static_cast<index_t>(Nv5.size());
+                }
+            }
+
+            for(natural_t N3 = 0; N3 < N2; ++N3)
+                Nv4[N3 + 1] += Nv4[N3];
+
+            // Blocks.
+            index_t* Nv6 = new index_t[Nv4[N2]];
+            value_t* Rv2 = new value_t[Nv4[N2] * N1 * N1];
+
+            // Blocks are first touched by the thread filling their block row, with the scheduling of Mlb_RvtNNNvNvRvRv_0.
+            #pragma omp parallel
+            {
+                std::vector<natural_t> Nv5;
+
+                #pragma omp for schedule(dynamic, 256)
+                for(natural_t N3 = 0; N3 < N2; ++N3) {
+                    Bk_NNNvNvNNvt_0(N0, N1, Nv2, Nv3, N3, Nv5);
+                    std::fill(Rv2 + Nv4[N3] * N1 * N1, Rv2 + Nv4[N3 + 1] * N1 * N1, static_cast<value_t>(0));
+
+                    for(natural_t N4 = 0; N4 < Nv5.size(); ++N4)
+                        Nv6[Nv4[N3] + N4] = static_cast<index_t>(Nv5[N4]);
+
+                    for(natural_t N4 = N3 * N1; N4 < (N3 + 1) * N1; ++N4)
+                        for(natural_t N5 = Nv2[N4]; N5 < Nv2[N4 + 1]; ++N5) {
+                            const natural_t N6 = std::lower_bound(Nv5.begin(), Nv5.end(), static_cast<natural_t>(Nv3[N5]) / N1) - Nv5.begin();
+
+                            Rv2[(Nv4[N3] + N6) * N1 * N1 + (N4 % N1) * N1 + Nv3[N5] % N1] = Rv1[N5];
+                        }
+                }
+            }
+
+            delete[] Nv2; delete[] Nv3; delete[] Rv1;
+
+            return {Nv4, Nv6, Rv2};
+        }
+
+
+        /**
+         * @brief Converts a (CSC) sparse matrix into a (DIA) one, when its entries lie on a few diagonals.
+         * The layout is kept only with at most dia_diagonals diagonals and when it streams fewer bytes than the (CSC) one, otherwise no diagonal is returned.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type.
+         * @return std::tuple<natural_t, integer_t*, value_t*> Diagonals, offsets and values [Spd].
+         */
+        template<typename index_t, typename value_t>
+        [[nodiscard]] std::tuple<natural_t, integer_t*, value_t*> Dia_NNvNvRv_NIvRv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0) {
+            std::vector<integer_t> Iv0;
+            bool B0 = true;
+
+            // Offsets, column minus row.
+            #pragma omp parallel
+            {
+                std::vector<integer_t> Iv1;
+
+                #pragma omp for
+                for(natural_t N1 = 0; N1 < N0; ++N1) {
+                    if(Iv1.size() > dia_diagonals)
+                        continue;
+
+                    for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2) {
+                        const integer_t I0 = static_cast<integer_t>(N1) - static_cast<integer_t>(Nv1[N2]);
+
+                        if(std::find(Iv1.begin(), Iv1.end(), I0) == Iv1.end())
+                            Iv1.push_back(I0);
+                    }
+                }
+
+                #pragma omp critical
+                {
+                    for(const integer_t& I0: Iv1)
+                        if(std::find(Iv0.begin(), Iv0.end(), I0) == Iv0.end())
+                            Iv0.push_back(I0);
+
+                    B0 = B0 && Iv0.size() <= dia_diagonals;
+                }
+            }
+
+            const natural_t N1 = Iv0.size();
+
+            if(!B0 || N1 == 0 || N1 * N0 * sizeof(real_t) >= Nv0[N0] * (sizeof(real_t) + sizeof(index_t)))
+                return {0, nullptr, nullptr};
+
+            std::sort(Iv0.begin(), Iv0.end());
+
+            // Values, by diagonal and row.
+            integer_t* Iv2 = new integer_t[N1];
+            value_t* Rv1 = new value_t[N1 * N0];
+
+            std::copy(Iv0.begin(), Iv0.end(), Iv2);
+
+            // First touch, by the blocks of rows of Mld_RvtNNIvRvRv_0.
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N0; N2 += DIA_BLOCK)
+                for(natural_t N3 = 0; N3 < N1; ++N3)
+                    std::fill(Rv1 + N3 * N0 + N2, Rv1 + N3 * N0 + std::min<natural_t>(N2 + DIA_BLOCK, N0), static_cast<value_t>(0));
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N0; ++N2)
+                for(natural_t N3 = Nv0[N2]; N3 < Nv0[N2 + 1]; ++N3) {
+                    const integer_t I0 = static_cast<integer_t>(N2) - static_cast<integer_t>(Nv1[N3]);
+                    const natural_t N4 = std::lower_bound(Iv2, Iv2 + N1, I0) - Iv2;
+
+                    Rv1[N4 * N0 + Nv1[N3]] = Rv0[N3];
+                }
+
+            return {N1, Iv2, Rv1};
+        }
+
+
+        /**
+         * @brief Adjacency of the symmetrized pattern of a (CSC) sparse matrix, without the diagonal.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t*, natural_t*> Pointers and neighbours, sorted [Adj].
+         */
+        template<typename index_t>
+        [[nodiscard]] static std::tuple<natural_t*, natural_t*> Adj_NNvNv_NvNv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            natural_t* Nv2 = new natural_t[N0 + 1]();
+
+            // Both directions.
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
+                    if(Nv1[N2] != N1) {
+                        ++Nv2[N1 + 1];
+                        ++Nv2[Nv1[N2] + 1];
+                    }
+
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Nv2[N1 + 1] += Nv2[N1];
+
+            natural_t* Nv3 = new natural_t[Nv2[N0]];
+            natural_t* Nv4 = new natural_t[N0];
+
+            std::copy(Nv2, Nv2 + N0, Nv4);
+
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
+                    if(Nv1[N2] != N1) {
+                        Nv3[Nv4[N1]++] = Nv1[N2];
+                        Nv3[Nv4[Nv1[N2]]++] = N1;
+                    }
+
+            // Repeated neighbours.
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                std::sort(Nv3 + Nv2[N1], Nv3 + Nv2[N1 + 1]);
+                Nv4[N1] = std::unique(Nv3 + Nv2[N1], Nv3 + Nv2[N1 + 1]) - (Nv3 + Nv2[N1]);
+            }
+
+            natural_t* Nv5 = new natural_t[N0 + 1];
+            Nv5[0] = 0;
+
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Nv5[N1 + 1] = Nv5[N1] + Nv4[N1];
+
+            natural_t* Nv6 = new natural_t[Nv5[N0]];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                std::copy(Nv3 + Nv2[N1], Nv3 + Nv2[N1] + Nv4[N1], Nv6 + Nv5[N1]);
+
+            delete[] Nv2; delete[] Nv3; delete[] Nv4;
+
+            return {Nv5, Nv6};
+        }
+
+
+        /**
+         * @brief Breadth-first levels from a node, within its component.
+         * 
+         * @param Nv0 Natural vector [Nv], adjacency pointers.
+         * @param Nv1 Natural vector [Nv], neighbours.
+         * @param N0 Natural number [N], root.
+         * @param Nvt0 Natural vector [Nv], target [t], levels, set to the maximum natural_t on the component.
+         * @param Nvt1 Natural vector [Nv], target [t], visit order.
+         * @return natural_t Natural number [N], visited nodes.
+         */
+        static natural_t Lv_NvNvNNvtNvt_N(const natural_t* Nv0, const natural_t* Nv1, const natural_t& N0, natural_t* Nvt0, natural_t* Nvt1) {
+            natural_t N1 = 0, N2 = 1;
+
+            Nvt0[N0] = 0;
+            Nvt1[0] = N0;
+
+            for(; N1 < N2; ++N1) {
+                const natural_t N3 = Nvt1[N1];
+
+                for(natural_t N4 = Nv0[N3]; N4 < Nv0[N3 + 1]; ++N4)
+                    if(Nvt0[Nv1[N4]] == std::numeric_limits<natural_t>::max()) {
+                        Nvt0[Nv1[N4]] = Nvt0[N3] + 1;
+                        Nvt1[N2++] = Nv1[N4];
+                    }
+            }
+
+            return N2;
+        }
+
+
+        /**
+         * @brief Reverse Cuthill-McKee ordering of a sparse matrix, on its symmetrized pattern.
+         * Every component starts from a pseudo-peripheral node, neighbours are visited by increasing degree.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @tparam index_t Index type.
+         * @return natural_t* Natural vector [Nv], new to old indices.
+         */
+        template<typename index_t>
+        [[nodiscard]] natural_t* Rcm_NNvNv_Nv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            const auto [Nv2, Nv3] = Adj_NNvNv_NvNv(N0, Nv0, Nv1);
+
+            natural_t* Nv4 = new natural_t[N0]; // Ordering.
+            natural_t* Nv5 = new natural_t[N0]; // Levels.
+            natural_t* Nv6 = new natural_t[N0]; // Visit order.
+            bool* Bv0 = new bool[N0]();
+
+            // Levels are reset after every sweep on the visited nodes only, O(nnz) over all the components.
+            std::fill_n(Nv5, N0, std::numeric_limits<natural_t>::max());
+
+            natural_t N1 = 0;
+
+            for(natural_t N2 = 0; N2 < N0; ++N2) {
+                if(Bv0[N2])
+                    continue;
+
+                // Pseudo-peripheral root.
+                natural_t N3 = N2, N4 = 0;
+
+                for(natural_t N5 = 0; N5 < RCM_SWEEPS; ++N5) {
+                    const natural_t N6 = Lv_NvNvNNvtNvt_N(Nv2, Nv3, N3, Nv5, Nv6);
+                    const natural_t N7 = Nv5[Nv6[N6 - 1]];
+
+                    // Smallest degree on the last level.
+                    natural_t N8 = Nv6[N6 - 1];
+
+                    for(natural_t N9 = N6; N9 > 0 && Nv5[Nv6[N9 - 1]] == N7; --N9)
+                        if(Nv2[Nv6[N9 - 1] + 1] - Nv2[Nv6[N9 - 1]] < Nv2[N8 + 1] - Nv2[N8])
+                            N8 = Nv6[N9 - 1];
+
+                    for(natural_t N9 = 0; N9 < N6; ++N9)
+                        Nv5[Nv6[N9]] = std::numeric_limits<natural_t>::max();
+
+                    if(N5 > 0 && N7 <= N4)
+                        break;
+
+                    N4 = N7;
+                    N3 = N8;
+                }
+
+                // Cuthill-McKee.
+                natural_t N5 = N1;
+
+                Nv4[N1++] = N3;
+                Bv0[N3] = true;
+
+                for(; N5 < N1; ++N5) {
+                    const natural_t N6 = Nv4[N5], N7 = N1;
+
+                    for(natural_t N8 = Nv2[N6]; N8 < Nv2[N6 + 1]; ++N8)
+                        if(!Bv0[Nv3[N8]]) {
+                            Bv0[Nv3[N8]] = true;
+                            Nv4[N1++] = Nv3[N8];
+                        }
+
+                    std::stable_sort(Nv4 + N7, Nv4 + N1, [&](const natural_t& N9, const natural_t& N10) {
+                        return Nv2[N9 + 1] - Nv2[N9] < Nv2[N10 + 1] - Nv2[N10];
+                    });
+                }
+            }
+
+            // Reverse.
+            std::reverse(Nv4, Nv4 + N0);
+
+            delete[] Nv2; delete[] Nv3;
+            delete[] Nv5; delete[] Nv6;
+            delete[] Bv0;
+
+            return Nv4;
+        }
+
+
+        /**
+         * @brief Permutes a (CSC) sparse matrix symmetrically, P A P^T, in parallel.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Nv2 Natural vector [Nv], new to old indices.
+         * @param B0 Boolean [B], symmetric (lower) storage, kept lower.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type.
+         * @return std::tuple<index_t*, index_t*, value_t*> (CSC) sparse matrix [Spc].
+         */
+        template<typename index_t, typename value_t>
+        [[nodiscard]] std::tuple<index_t*, index_t*, value_t*> Prm_NNvNvRvNvB_NvNvRv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const natural_t* Nv2, const bool& B0) {
+            const natural_t N1 = Nv0[N0];
+
+            // Old to new indices.
+            natural_t* Nv3 = new natural_t[N0];
+
+            #pragma omp parallel for
+            for(natural_t N2 = 0; N2 < N0; ++N2)
+                Nv3[Nv2[N2]] = N2;
+
+            // Pointers, new columns are old columns or, for symmetric storage, counted in parallel.
+            index_t* Nv4 = new index_t[N0 + 1]();
+
+            if(!B0) {
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N0; ++N2)
+                    Nv4[N2 + 1] = Nv0[Nv2[N2] + 1] - Nv0[Nv2[N2]];
+            } else {
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N0; ++N2)
+                    for(natural_t N3 = Nv0[N2]; N3 < Nv0[N2 + 1]; ++N3) {
+                        #pragma omp atomic
+                        ++Nv4[std::min(Nv3[Nv1[N3]], Nv3[N2]) + 1];
+                    }
+            }
+
+            Ps_NvtN_0(Nv4, N0);
+
+            index_t* Nv5 = new index_t[N1];
+            value_t* Rv1 = new value_t[N1];
+
+            if(!B0) {
+
+                // New columns are old columns, gathered in parallel.
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N0; ++N2) {
+                    const natural_t N3 = Nv2[N2];
+
+                    for(natural_t N4 = Nv0[N3]; N4 < Nv0[N3 + 1]; ++N4) {
+                        Nv5[Nv4[N2] + N4 - Nv0[N3]] = static_cast<index_t>(Nv3[Nv1[N4]]);
+                        Rv1[Nv4[N2] + N4 - Nv0[N3]] = Rv0[N4];
+                    }
+                }
+            } else {
+
+                // Entries may move between columns, scattered in parallel and sorted afterwards.
+                index_t* Nv6 = new index_t[N0];
+
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N0; ++N2)
+                    Nv6[N2] = Nv4[N2];
+
+                #pragma omp parallel for
+                for(natural_t N2 = 0; N2 < N0; ++N2)
+                    for(natural_t N3 = Nv0[N2]; N3 < Nv0[N2 + 1]; ++N3) {
+                        const natural_t N4 = Nv3[Nv1[N3]], N5 = Nv3[N2];
+                        index_t N6;
+
+                        #pragma omp atomic capture
+                        N6 = Nv6[std::min(N4, N5)]++;
+
+                        Nv5[N6] = static_cast<index_t>(std::max(N4, N5));
+                        Rv1[N6] = Rv0[N3];
+                    }
+
+                delete[] Nv6;
+            }
+
+            // Sorted columns.
+            #pragma omp parallel
+            {
+                std::vector<std::pair<index_t, value_t>> Pv0;
+
+                #pragma omp for schedule(dynamic, 256)
+                for(natural_t N2 = 0; N2 < N0; ++N2) {
+                    Pv0.clear();
+
+                    for(natural_t N3 = Nv4[N2]; N3 < Nv4[N2 + 1]; ++N3)
+                        Pv0.emplace_back(Nv5[N3], Rv1[N3]);
+
+                    std::sort(Pv0.begin(), Pv0.end(), [](const auto& P0, const auto& P1) { return P0.first < P1.first; });
+
+                    for(natural_t N3 = Nv4[N2]; N3 < Nv4[N2 + 1]; ++N3)
+                        std::tie(Nv5[N3], Rv1[N3]) = Pv0[N3 - Nv4[N2]];
+                }
+            }
+
+            delete[] Nv3;
+
+            return {Nv4, Nv5, Rv1};
+        }
+
+
+        /**
+         * @brief Permutes a real_t*, in parallel.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param Nv0 Natural vector [Nv], new to old indices.
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Prm_RvtRvNvN_0(scalar_t* Rvt0, const scalar_t* Rv0, const natural_t* Nv0, const natural_t& N0) {
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Rvt0[N1] = Rv0[Nv0[N1]];
+        }
+
+
+        /**
+         * @brief Inverse of Prm_RvtRvNvN_0, in parallel.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param Nv0 Natural vector [Nv], new to old indices.
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Ipr_RvtRvNvN_0(scalar_t* Rvt0, const scalar_t* Rv0, const natural_t* Nv0, const natural_t& N0) {
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Rvt0[Nv0[N1]] = Rv0[N1];
+        }
+
+
+        /**
+         * @brief Bandwidth and profile of a (CSC) sparse matrix.
+         * The profile sums the envelopes of the columns, the diagonal included.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within columns.
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t> Natural numbers [N], bandwidth and profile.
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, natural_t> Bnd_NNvNv_NN(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            natural_t N1 = 0, N2 = 0;
+
+            #pragma omp parallel for reduction(max: N1) reduction(+: N2)
+            for(natural_t N3 = 0; N3 < N0; ++N3) {
+                if(Nv0[N3] == Nv0[N3 + 1])
+                    continue;
+
+                const natural_t N4 = std::min<natural_t>(Nv1[Nv0[N3]], N3), N5 = std::max<natural_t>(Nv1[Nv0[N3 + 1] - 1], N3);
+
+                N1 = std::max(N1, std::max(N3 - N4, N5 - N3));
+                N2 += N5 - N4;
+            }
+
+            return {N1, N2};
+        }
+
+
+        /**
+         * @brief Multiplies a (CSC) sparse matrix by a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlc_RvtNNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1) {
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                const scalar_t R0 = Rv1[N1];
+
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
+                    Rvt0[Nv1[N2]] += Rv0[N2] * R0;
+            }
+        }
+
+
+        /**
+         * @brief Splits the rows of a (CSC) sparse matrix among threads for Mlc_RvtNNvNvRvRvNNvNvRvt_0, balancing their entries.
+         * Every thread gets a range of rows and the window of columns reaching it.
+         * When the windows read more than split_redundancy times the columns, as for unstructured matrices, the columns are split instead and every thread gets the window of rows they reach.
+         * The last of the 2 * N1 + 1 windows entries tells the splitting: 0 for rows, 1 for columns.
+         * The partition itself takes O(N1) storage; the column splitting also needs a private window of rows per thread while multiplying, up to N0 rows each.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within columns.
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t*, natural_t*> Threads, row (or column) bounds and column (or row) windows [Spl].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*> Spl_NNvNv_NNvNv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            #ifdef _OPENMP
+            const natural_t N1 = std::max<natural_t>(1, std::min<natural_t>(static_cast<natural_t>(omp_get_max_threads()), N0));
+            #else
+            const natural_t N1 = 1;
+            #endif
+
+            const natural_t N2 = Nv0[N0];
+
+            // Entries per row.
+            natural_t* Nv2 = new natural_t[N0 + 1]();
+
+            for(natural_t N3 = 0; N3 < N2; ++N3)
+                ++Nv2[Nv1[N3] + 1];
+
+            for(natural_t N3 = 0; N3 < N0; ++N3)
+                Nv2[N3 + 1] += Nv2[N3];
+
+            // Row bounds.
+            natural_t* Nv3 = new natural_t[N1 + 1];
+            Nv3[0] = 0;
+            Nv3[N1] = N0;
+
+            for(natural_t N3 = 1; N3 < N1; ++N3)
+                Nv3[N3] = std::max<natural_t>(Nv3[N3 - 1], std::lower_bound(Nv2, Nv2 + N0 + 1, N2 * N3 / N1) - Nv2);
+
+            delete[] Nv2;
+
+            // Column windows.
+            natural_t* Nv4 = new natural_t[2 * N1 + 1];
+
+            for(natural_t N3 = 0; N3 < N1; ++N3) {
+                Nv4[2 * N3] = N0;
+                Nv4[2 * N3 + 1] = 0;
+            }
+
+            Nv4[2 * N1] = 0;
+
+            for(natural_t N3 = 0; N3 < N0; ++N3) {
+                if(Nv0[N3] == Nv0[N3 + 1])
+                    continue;
+
+                const natural_t N4 = std::upper_bound(Nv3, Nv3 + N1 + 1, static_cast<natural_t>(Nv1[Nv0[N3]])) - Nv3 - 1;
+                const natural_t N5 = std::upper_bound(Nv3, Nv3 + N1 + 1, static_cast<natural_t>(Nv1[Nv0[N3 + 1] - 1])) - Nv3 - 1;
+
+                for(natural_t N6 = N4; N6 <= N5; ++N6) {
+                    Nv4[2 * N6] = std::min(Nv4[2 * N6], N3);
+                    Nv4[2 * N6 + 1] = N3 + 1;
+                }
+            }
+
+            // Columns read by the windows.
+            natural_t N3 = 0;
+
+            for(natural_t N4 = 0; N4 < N1; ++N4)
+                if(Nv4[2 * N4] < Nv4[2 * N4 + 1])
+                    N3 += Nv4[2 * N4 + 1] - Nv4[2 * N4];
+
+            if(N1 == 1 || N3 <= split_redundancy * N0)
+                return {N1, Nv3, Nv4};
+
+            // Column bounds.
+            for(natural_t N4 = 1; N4 < N1; ++N4)
+                Nv3[N4] = std::max<natural_t>(Nv3[N4 - 1], std::lower_bound(Nv0, Nv0 + N0 + 1, N2 * N4 / N1) - Nv0);
+
+            // Row windows.
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N1; ++N4) {
+                natural_t N5 = N0, N6 = 0;
+
+                for(natural_t N7 = Nv3[N4]; N7 < Nv3[N4 + 1]; ++N7)
+                    if(Nv0[N7] < Nv0[N7 + 1]) {
+                        N5 = std::min<natural_t>(N5, Nv1[Nv0[N7]]);
+                        N6 = std::max<natural_t>(N6, Nv1[Nv0[N7 + 1] - 1] + 1);
+                    }
+
+                Nv4[2 * N4] = std::min(N5, N6);
+                Nv4[2 * N4 + 1] = N6;
+            }
+
+            Nv4[2 * N1] = 1;
+
+            return {N1, Nv3, Nv4};
+        }
+
+
+        /**
+         * @brief Splits the columns of a symmetric sparse matrix, stored as its lower (CSC) part, among threads for Mls_RvtNNvNvRvRvNNvNvRvt_0 and Mls_RvtNNvCvRvRvNNvNvRvt_0, balancing their entries.
+         * Every thread gets a range of columns, the end of the rows they reach and, for a delta encoding, the offset of its first column.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within columns.
+         * @param Cv0 Byte vector [Cv], from Dlt_NNvNv_CvN, or nullptr.
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t*, natural_t*> Threads, column bounds and row windows [Sps].
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*> Sps_NNvNvCv_NNvNv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const unsigned char* Cv0) {
+            #ifdef _OPENMP
+            const natural_t N1 = std::max<natural_t>(1, std::min<natural_t>(static_cast<natural_t>(omp_get_max_threads()), N0));
+            #else
+            const natural_t N1 = 1;
+            #endif
+
+            const natural_t N2 = Nv0[N0];
+
+            // Column bounds.
+            natural_t* Nv2 = new natural_t[N1 + 1];
+            Nv2[0] = 0;
+            Nv2[N1] = N0;
+
+            for(natural_t N3 = 1; N3 < N1; ++N3)
+                Nv2[N3] = std::max<natural_t>(Nv2[N3 - 1], std::lower_bound(Nv0, Nv0 + N0 + 1, N2 * N3 / N1) - Nv0);
+
+            // Row windows and offsets.
+            natural_t* Nv3 = new natural_t[2 * N1]();
+
+            #pragma omp parallel for
+            for(natural_t N3 = 0; N3 < N1; ++N3) {
+                natural_t N4 = Nv2[N3 + 1];
+
+                for(natural_t N5 = Nv2[N3]; N5 < Nv2[N3 + 1]; ++N5)
+                    if(Nv0[N5] < Nv0[N5 + 1])
+                        N4 = std::max<natural_t>(N4, Nv1[Nv0[N5 + 1] - 1] + 1);
+
+                Nv3[2 * N3] = N4;
+            }
+
+            if(Cv0 != nullptr) {
+                const unsigned char* Cv1 = Cv0;
+
+                for(natural_t N3 = 0, N4 = 0; N3 < N1; ++N3) {
+                    for(; N4 < Nv2[N3]; ++N4)
+                        for(natural_t N5 = Nv0[N4]; N5 < Nv0[N4 + 1]; ++N5)
+                            Vr_Cv_N(Cv1);
+
+                    Nv3[2 * N3 + 1] = static_cast<natural_t>(Cv1 - Cv0);
+                }
+            }
+
+            return {N1, Nv2, Nv3};
+        }
+
+
+        /**
+         * @brief Accumulates ranges of columns of a (CSC) sparse matrix into private windows of rows, merged afterwards, see Spl_NNvNv_NNvNv.
+         * F0(N2, Rvt1, N3) multiplies the range N2, writing its own rows into Rvt0 and the other ones into Rvt1, its window from row N3, each row holding N0 scalars.
+         * Windows are merged in thread order, so that products are deterministic for a given number of threads, but not bitwise equal across thread counts, nor to the serial product.
+         * Windows are laid out one after the other in Rvt1, owned by the caller and grown as needed, each one spanning the rows its ranges reach, up to the whole matrix.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N], scalars per row.
+         * @param N1 Natural number [N], from Spl_NNvNv_NNvNv.
+         * @param Nv0 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Nv1 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Rvt1 Real vector [Rv], target [t], windows.
+         * @param F0 Function [F].
+         * @tparam scalar_t Scalar type.
+         * @tparam function_t Function type.
+         */
+        template<typename scalar_t, typename function_t>
+        static void Mlp_RvtNNNvNvRvtF_0(scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, std::vector<scalar_t>& Rvt1, const function_t& F0) {
+            natural_t* Nv2 = new natural_t[2 * N1];
+            natural_t* Nv3 = new natural_t[N1 + 1]; // Windows' offsets.
+
+            #pragma omp parallel num_threads(N1)
+            {
+                #ifdef _OPENMP
+                const natural_t N2 = static_cast<natural_t>(omp_get_thread_num()), N3 = static_cast<natural_t>(omp_get_num_threads());
+                #else
+                const natural_t N2 = 0, N3 = 1;
+                #endif
+
+                natural_t N4 = Nv1[2 * N2], N5 = Nv1[2 * N2 + 1];
+
+                for(natural_t N6 = N2 + N3; N6 < N1; N6 += N3) {
+                    N4 = std::min(N4, Nv1[2 * N6]);
+                    N5 = std::max(N5, Nv1[2 * N6 + 1]);
+                }
+
+                N4 = std::min(N4, N5);
+
+                Nv2[2 * N2] = N4;
+                Nv2[2 * N2 + 1] = N5;
+
+                #pragma omp barrier
+
+                #pragma omp single
+                {
+                    Nv3[0] = 0;
+
+                    for(natural_t N6 = 0; N6 < N3; ++N6)
+                        Nv3[N6 + 1] = Nv3[N6] + (Nv2[2 * N6 + 1] - Nv2[2 * N6]) * N0;
+
+                    if(Rvt1.size() < Nv3[N3])
+                        Rvt1.resize(Nv3[N3]);
+                }
+
+                scalar_t* Rv0 = Rvt1.data() + Nv3[N2];
+                std::fill_n(Rv0, Nv3[N2 + 1] - Nv3[N2], static_cast<scalar_t>(0.0));
+
+                for(natural_t N6 = N2; N6 < N1; N6 += N3)
+                    F0(N6, Rv0, N4);
+
+                #pragma omp barrier
+
+                // Merge.
+                for(natural_t N6 = N2; N6 < N1; N6 += N3)
+                    for(natural_t N7 = 0; N7 < N3; ++N7) {
+                        const natural_t N8 = std::max(Nv0[N6], Nv2[2 * N7]), N9 = std::min(Nv0[N6 + 1], Nv2[2 * N7 + 1]);
+
+                        for(natural_t N10 = N8 * N0; N10 < N9 * N0; ++N10)
+                            Rvt0[N10] += Rvt1[Nv3[N7] + N10 - Nv2[2 * N7] * N0];
+                    }
+            }
+
+            delete[] Nv2;
+            delete[] Nv3;
+        }
+
+
+        /**
+         * @brief Multiplies a (CSC) sparse matrix by a real_t*, in parallel.
+         * Every thread owns a range of rows and accumulates its entries in column order, the result is bitwise equal to Mlc_RvtNNvNvRvRv_0 for any number of threads.
+         * Wide windows have their columns split instead, see Spl_NNvNv_NNvNv and Mlp_RvtNNNvNvRvtF_0, the result being then deterministic only for a given number of threads.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N1 Natural number [N], from Spl_NNvNv_NNvNv.
+         * @param Nv2 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Nv3 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Rvt1 Real vector [Rv], target [t], windows of the column splitting, see Mlp_RvtNNNvNvRvtF_0.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlc_RvtNNvNvRvRvNNvNvRvt_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3, std::vector<scalar_t>& Rvt1) {
+            if(N1 == 1)
+                return Mlc_RvtNNvNvRvRv_0(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+
+            // Column splitting.
+            if(Nv3[2 * N1] == 1)
+                return Mlp_RvtNNNvNvRvtF_0(Rvt0, 1, N1, Nv2, Nv3, Rvt1, [&](const natural_t& N2, scalar_t* Rvt2, const natural_t& N3) {
+                    const natural_t N4 = Nv2[N2], N5 = Nv2[N2 + 1];
+
+                    for(natural_t N6 = N4; N6 < N5; ++N6) {
+                        const scalar_t R0 = Rv1[N6];
+
+                        for(natural_t N7 = Nv0[N6]; N7 < Nv0[N6 + 1]; ++N7) {
+                            const natural_t N8 = Nv1[N7];
+
+                            if(N8 - N4 < N5 - N4)
+                                Rvt0[N8] += Rv0[N7] * R0;
+                            else
+                                Rvt2[N8 - N3] += Rv0[N7] * R0;
+                        }
+                    }
+                });
+
+            #pragma omp parallel for schedule(static, 1) num_threads(N1)
+            for(natural_t N2 = 0; N2 < N1; ++N2) {
+                const index_t N3 = static_cast<index_t>(Nv2[N2]), N4 = static_cast<index_t>(Nv2[N2 + 1]);
+
+                for(natural_t N5 = Nv3[2 * N2]; N5 < Nv3[2 * N2 + 1]; ++N5) {
+                    const natural_t N6 = Nv0[N5], N7 = Nv0[N5 + 1];
+
+                    if(N6 == N7)
+                        continue;
+
+                    const scalar_t R0 = Rv1[N5];
+
+                    // Inner column.
+                    if(Nv1[N6] >= N3 && Nv1[N7 - 1] < N4) {
+                        for(natural_t N8 = N6; N8 < N7; ++N8)
+                            Rvt0[Nv1[N8]] += Rv0[N8] * R0;
+
+                        continue;
+                    }
+
+                    // Boundary column.
+                    for(natural_t N8 = std::lower_bound(Nv1 + N6, Nv1 + N7, N3) - Nv1; N8 < N7 && Nv1[N8] < N4; ++N8)
+                        Rvt0[Nv1[N8]] += Rv0[N8] * R0;
+                }
+            }
+        }
+
+
+        /**
+         * @brief Sketches the rows N0 to N1 of a real_t*, S * Rv1 restricted to them.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N], first row.
+         * @param N1 Natural number [N], last row, excluded.
+         * @param Nv0 Natural vector [Nv], sketch.
+         * @param Nv1 Natural vector [Nv], sketch.
+         * @param Rv0 Real vector [Rv], sketch.
+         * @param Rv1 Real vector [Rv].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        static inline void Sk_RvtNNNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, const scalar_t* Rv0, const scalar_t* Rv1) {
+            for(natural_t N2 = N0; N2 < N1; ++N2) {
+                const scalar_t R0 = Rv1[N2];
+
+                for(natural_t N3 = Nv0[N2]; N3 < Nv0[N2 + 1]; ++N3)
+                    Rvt0[Nv1[N3]] += Rv0[N3] * R0;
+            }
+        }
+
+
+        /**
+         * @brief Multiplies a (CSC) sparse matrix by a real_t*, in parallel, and sketches the result.
+         * Every thread sketches its range of rows as soon as it is completed, as in Mlc_RvtNNvNvRvRvNNvNvRvt_0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], accumulates A * Rv1.
+         * @param Rvt1 Real vector [Rv], target [t], accumulates S * Rvt0.
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N1 Natural number [N], from Spl_NNvNv_NNvNv.
+         * @param Nv2 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Nv3 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param N2 Natural number [N], sketch rows.
+         * @param Nv4 Natural vector [Nv], sketch.
+         * @param Nv5 Natural vector [Nv], sketch.
+         * @param Rv2 Real vector [Rv], sketch.
+         * @param Rvt2 Real vector [Rv], target [t], private sketches and windows of the column splitting.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlk_RvtRvtNNvNvRvRvNNvNvNNvNvRvRvt_0(scalar_t* Rvt0, scalar_t* Rvt1, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3, const natural_t& N2, const natural_t* Nv4, const natural_t* Nv5, const scalar_t* Rv2, std::vector<scalar_t>& Rvt2) {
+            if(N1 == 1) {
+                Mlc_RvtNNvNvRvRv_0(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+                return Sk_RvtNNNvNvRvRv_0(Rvt1, 0, N0, Nv4, Nv5, Rv2, Rvt0);
+            }
+
+            // Column splitting, rows are sketched once merged.
+            if(Nv3[2 * N1] == 1)
+                Mlc_RvtNNvNvRvRvNNvNvRvt_0(Rvt0, N0, Nv0, Nv1, Rv0, Rv1, N1, Nv2, Nv3, Rvt2);
+
+            // Private sketches.
+            if(Rvt2.size() < N1 * N2)
+                Rvt2.resize(N1 * N2);
+
+            scalar_t* Rv3 = Rvt2.data();
+            std::fill_n(Rv3, N1 * N2, static_cast<scalar_t>(0.0));
+
+            if(Nv3[2 * N1] == 1) {
+                #pragma omp parallel for schedule(static, 1) num_threads(N1)
+                for(natural_t N3 = 0; N3 < N1; ++N3)
+                    Sk_RvtNNNvNvRvRv_0(Rv3 + N3 * N2, Nv2[N3], Nv2[N3 + 1], Nv4, Nv5, Rv2, Rvt0);
+            } else {
+                #pragma omp parallel for schedule(static, 1) num_threads(N1)
+                for(natural_t N3 = 0; N3 < N1; ++N3) {
+                    const index_t N4 = static_cast<index_t>(Nv2[N3]), N5 = static_cast<index_t>(Nv2[N3 + 1]);
+
+                    for(natural_t N6 = Nv3[2 * N3]; N6 < Nv3[2 * N3 + 1]; ++N6) {
+                        const natural_t N7 = Nv0[N6], N8 = Nv0[N6 + 1];
+
+                        if(N7 == N8)
+                            continue;
+
+                        const scalar_t R0 = Rv1[N6];
+
+                        // Inner column.
+                        if(Nv1[N7] >= N4 && Nv1[N8 - 1] < N5) {
+                            for(natural_t N9 = N7; N9 < N8; ++N9)
+                                Rvt0[Nv1[N9]] += Rv0[N9] * R0;
+
+                            continue;
+                        }
+
+                        // Boundary column.
+                        for(natural_t N9 = std::lower_bound(Nv1 + N7, Nv1 + N8, N4) - Nv1; N9 < N8 && Nv1[N9] < N5; ++N9)
+                            Rvt0[Nv1[N9]] += Rv0[N9] * R0;
+                    }
+
+                    Sk_RvtNNNvNvRvRv_0(Rv3 + N3 * N2, N4, N5, Nv4, Nv5, Rv2, Rvt0);
+                }
+            }
+
+            // Reduction.
+            for(natural_t N3 = 0; N3 < N1; ++N3)
+                for(natural_t N4 = 0; N4 < N2; ++N4)
+                    Rvt1[N4] += Rv3[N3 * N2 + N4];
+        }
+
+
+        /**
+         * @brief Multiplies a (CSR) sparse matrix by a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlr_RvtNNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1) {
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
+                    Rvt0[N1] += Rv0[N2] * Rv1[Nv1[N2]];
+        }
+
+
+        /**
+         * @brief Multiplies a symmetric sparse matrix, stored as its lower (CSC) part, by a real_t*.
+         * Every stored entry contributes to both its row and its column.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mls_RvtNNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1) {
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                const scalar_t R0 = Rv1[N1];
+                scalar_t R1 = 0.0;
+
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2) {
+                    const natural_t N3 = Nv1[N2];
+                    const scalar_t R2 = Rv0[N2];
+
+                    Rvt0[N3] += R2 * R0;
+
+                    if(N3 != N1)
+                        R1 += R2 * Rv1[N3];
+                }
+
+                Rvt0[N1] += R1;
+            }
+        }
+
+
+        /**
+         * @brief Multiplies a delta-encoded (CSC) sparse matrix by a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Cv0 Byte vector [Cv], from Dlt_NNvNv_CvN.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlc_RvtNNvCvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const unsigned char* Cv0, const value_t* Rv0, const scalar_t* Rv1) {
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                if(Nv0[N1] == Nv0[N1 + 1])
+                    continue;
+
+                const scalar_t R0 = Rv1[N1];
+                natural_t N3 = Uz_NN_N(Vr_Cv_N(Cv0), N1);
+
+                Rvt0[N3] += Rv0[Nv0[N1]] * R0;
+
+                for(natural_t N2 = Nv0[N1] + 1; N2 < Nv0[N1 + 1]; ++N2) {
+                    N3 += Vr_Cv_N(Cv0);
+                    Rvt0[N3] += Rv0[N2] * R0;
+                }
+            }
+        }
+
+
+        /**
+         * @brief Multiplies a delta-encoded symmetric (CSC) sparse matrix, stored as its lower triangle, by a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Cv0 Byte vector [Cv], from Dlt_NNvNv_CvN.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mls_RvtNNvCvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const unsigned char* Cv0, const value_t* Rv0, const scalar_t* Rv1) {
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                if(Nv0[N1] == Nv0[N1 + 1])
+                    continue;
+
+                const scalar_t R0 = Rv1[N1];
+                scalar_t R1 = 0.0;
+
+                natural_t N3 = Uz_NN_N(Vr_Cv_N(Cv0), N1);
+
+                for(natural_t N2 = Nv0[N1];;) {
+                    const scalar_t R2 = Rv0[N2];
+
+                    Rvt0[N3] += R2 * R0;
+
+                    if(N3 != N1)
+                        R1 += R2 * Rv1[N3];
+
+                    if(++N2 == Nv0[N1 + 1])
+                        break;
+
+                    N3 += Vr_Cv_N(Cv0);
+                }
+
+                Rvt0[N1] += R1;
+            }
+        }
 
-namespace nass {
-    namespace internal {
 
         /**
-         * @brief Loads a (CSC) sparse matrix from a file.
+         * @brief Runs the column ranges of a symmetric product in parallel and merges their contributions past them.
+         * Every range writes the rows it owns in place and the rows past them in its thread's window, then every range gathers its rows from every window, in thread order.
+         * Windows are laid out one after the other in Rvt1, owned by the caller and grown as needed.
          * 
-         * @param St String [St]
-         * @return std::tuple<natural_t, natural_t*, natural_t*, real_t*> (CSC) sparse matrix [Spc].
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N1 Natural number [N], from Sps_NNvNvCv_NNvNv.
+         * @param Nv2 Natural vector [Nv], from Sps_NNvNvCv_NNvNv.
+         * @param Nv3 Natural vector [Nv], from Sps_NNvNvCv_NNvNv.
+         * @param Rvt1 Real vector [Rv], target [t], windows.
+         * @param F0 Range product, given the range, the window and its first row.
+         * @tparam scalar_t Scalar type.
+         * @tparam function_t Range product type.
          */
-        [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*, real_t*> Spc_St_NNvNvRv(const std::string& St0) {
-            natural_t N0, N1, N2, N3 = 0, N4 = 0;
-            real_t R0;
-            
-            // Line and file.
-            std::string St1;
-            std::ifstream F0(St0);
+        template<typename scalar_t, typename function_t>
+        static void Mlw_RvtNNvNvRvtF_0(scalar_t* Rvt0, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3, std::vector<scalar_t>& Rvt1, const function_t& F0) {
+            natural_t* Nv4 = new natural_t[2 * N1];
+            natural_t* Nv5 = new natural_t[N1 + 1]; // Windows' offsets.
 
-            // Skips and first line.
-            do { std::getline(F0, St1); } while(St1[0] == '%');
+            #pragma omp parallel num_threads(N1)
+            {
+                #ifdef _OPENMP
+                const natural_t N2 = static_cast<natural_t>(omp_get_thread_num()), N3 = static_cast<natural_t>(omp_get_num_threads());
+                #else
+                const natural_t N2 = 0, N3 = 1;
+                #endif
 
-            // First line stream.
-            std::istringstream Ss0(St1);
+                natural_t N4 = Nv2[N2 + 1], N5 = N4;
 
-            // Parameters.
-            Ss0 >> N0; // Rows.
-            Ss0 >> N1; // Columns.
-            Ss0 >> N2; // Entries.
+                for(natural_t N6 = N2; N6 < N1; N6 += N3)
+                    N5 = std::max(N5, Nv3[2 * N6]);
 
-            // Square check.
-            assert(N0 == N1);
+                Nv4[2 * N2] = N4;
+                Nv4[2 * N2 + 1] = N5;
 
-            // Initialization.
-            natural_t* Nv0 = new natural_t[N1 + 1];
-            natural_t* Nv1 = new natural_t[N2];
-            real_t* Rv0 = new real_t[N2];
+                #pragma omp barrier
 
-            // Reading.
-            while(std::getline(F0, St1)) {
+                #pragma omp single
+                {
+                    Nv5[0] = 0;
 
-                // Line stream.
-                std::istringstream Ss1(St1);
+                    for(natural_t N6 = 0; N6 < N3; ++N6)
+                        Nv5[N6 + 1] = Nv5[N6] + Nv4[2 * N6 + 1] - Nv4[2 * N6];
 
-                // Coordinates and entry.
-                Ss1 >> N1; --N1; // Row.
-                Ss1 >> N2; --N2; // Column.
-                Ss1 >> R0; // Entry.
+                    if(Rvt1.size() < Nv5[N3])
+                        Rvt1.resize(Nv5[N3]);
+                }
 
-                // Sparse check.
-                if(std::abs(R0) < real_tol)
-                    continue;
+                scalar_t* Rv0 = Rvt1.data() + Nv5[N2];
+                std::fill_n(Rv0, N5 - N4, static_cast<scalar_t>(0.0));
+
+                for(natural_t N6 = N2; N6 < N1; N6 += N3)
+                    F0(N6, Rv0, N4);
 
-                for(; N3 < N2; ++N3)
-                    Nv0[N3 + 1] = N4;
+                #pragma omp barrier
 
-                Nv1[N4] = N1;
-                Rv0[N4] = R0;
+                // Merge.
+                for(natural_t N6 = N2; N6 < N1; N6 += N3)
+                    for(natural_t N7 = 0; N7 < N3; ++N7) {
+                        const natural_t N8 = std::max(Nv2[N6], Nv4[2 * N7]), N9 = std::min(Nv2[N6 + 1], Nv4[2 * N7 + 1]);
 
-                ++N4;
+                        for(natural_t N10 = N8; N10 < N9; ++N10)
+                            Rvt0[N10] += Rvt1[Nv5[N7] + N10 - Nv4[2 * N7]];
+                    }
             }
 
-            // Last entries.
-            for(; N3 < N0; ++N3)
-                Nv0[N3 + 1] = N4;
+            delete[] Nv4;
+            delete[] Nv5;
+        }
 
-            // File closing.
-            F0.close();
 
-            return {N0, Nv0, Nv1, Rv0};
+        /**
+         * @brief Multiplies a symmetric sparse matrix, stored as its lower (CSC) part, by a real_t*, in parallel.
+         * Every thread owns a range of columns, see Sps_NNvNvCv_NNvNv, and accumulates the rows past it in a private window, merged afterwards.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N1 Natural number [N], from Sps_NNvNvCv_NNvNv.
+         * @param Nv2 Natural vector [Nv], from Sps_NNvNvCv_NNvNv.
+         * @param Nv3 Natural vector [Nv], from Sps_NNvNvCv_NNvNv.
+         * @param Rvt1 Real vector [Rv], target [t], windows, see Mlw_RvtNNvNvRvtF_0.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mls_RvtNNvNvRvRvNNvNvRvt_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3, std::vector<scalar_t>& Rvt1) {
+            if(N1 == 1)
+                return Mls_RvtNNvNvRvRv_0(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+
+            Mlw_RvtNNvNvRvtF_0(Rvt0, N1, Nv2, Nv3, Rvt1, [&](const natural_t& N2, scalar_t* Rvt2, const natural_t& N3) {
+                const natural_t N4 = Nv2[N2 + 1];
+
+                for(natural_t N5 = Nv2[N2]; N5 < N4; ++N5) {
+                    const scalar_t R0 = Rv1[N5];
+                    scalar_t R1 = 0.0;
+
+                    for(natural_t N6 = Nv0[N5]; N6 < Nv0[N5 + 1]; ++N6) {
+                        const natural_t N7 = Nv1[N6];
+                        const scalar_t R2 = Rv0[N6];
+
+                        if(N7 < N4)
+                            Rvt0[N7] += R2 * R0;
+                        else
+                            Rvt2[N7 - N3] += R2 * R0;
+
+                        if(N7 != N5)
+                            R1 += R2 * Rv1[N7];
+                    }
+
+                    Rvt0[N5] += R1;
+                }
+            });
         }
 
 
         /**
-         * @brief Loads a (CSR) sparse matrix from a file.
+         * @brief Multiplies a delta-encoded symmetric (CSC) sparse matrix, stored as its lower triangle, by a real_t*, in parallel.
+         * Every thread decodes its range of columns from its offset, see Sps_NNvNvCv_NNvNv, as in Mls_RvtNNvNvRvRvNNvNvRvt_0.
          * 
-         * @param St String [St]
-         * @return std::tuple<natural_t, natural_t*, natural_t*, real_t*> (CSC) sparse matrix [Spc].
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Cv0 Byte vector [Cv], from Dlt_NNvNv_CvN.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N1 Natural number [N], from Sps_NNvNvCv_NNvNv on Cv0.
+         * @param Nv2 Natural vector [Nv], from Sps_NNvNvCv_NNvNv on Cv0.
+         * @param Nv3 Natural vector [Nv], from Sps_NNvNvCv_NNvNv on Cv0.
+         * @param Rvt1 Real vector [Rv], target [t], windows, see Mlw_RvtNNvNvRvtF_0.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
          */
-        [[nodiscard]] std::tuple<natural_t, natural_t*, natural_t*, real_t*> Spr_St_NNvNvRv(const std::string& St0) {
-            natural_t N0, N1, N2, N3 = 0, N4 = 0;
-            real_t R0;
-            
-            // Line and file.
-            std::string St1;
-            std::ifstream F0(St0);
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mls_RvtNNvCvRvRvNNvNvRvt_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const unsigned char* Cv0, const value_t* Rv0, const scalar_t* Rv1, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3, std::vector<scalar_t>& Rvt1) {
+            if(N1 == 1)
+                return Mls_RvtNNvCvRvRv_0(Rvt0, N0, Nv0, Cv0, Rv0, Rv1);
 
-            // Skips and first line.
-            do { std::getline(F0, St1); } while(St1[0] == '%');
+            Mlw_RvtNNvNvRvtF_0(Rvt0, N1, Nv2, Nv3, Rvt1, [&](const natural_t& N2, scalar_t* Rvt2, const natural_t& N3) {
+                const natural_t N4 = Nv2[N2 + 1];
+                const unsigned char* Cv1 = Cv0 + Nv3[2 * N2 + 1];
 
-            // First line stream.
-            std::istringstream Ss0(St1);
+                for(natural_t N5 = Nv2[N2]; N5 < N4; ++N5) {
+                    if(Nv0[N5] == Nv0[N5 + 1])
+                        continue;
 
-            // Parameters.
-            Ss0 >> N0; // Rows.
-            Ss0 >> N1; // Columns.
-            Ss0 >> N2; // Entries.
+                    const scalar_t R0 = Rv1[N5];
+                    scalar_t R1 = 0.0;
 
-            // Square check.
-            assert(N0 == N1);
+                    natural_t N7 = Uz_NN_N(Vr_Cv_N(Cv1), N5);
 
-            // Initialization.
-            natural_t* Nv0 = new natural_t[N0 + 1];
-            natural_t* Nv1 = new natural_t[N2];
-            real_t* Rv0 = new real_t[N2];
+                    for(natural_t N6 = Nv0[N5];;) {
+                        const scalar_t R2 = Rv0[N6];
 
-            // Reading.
-            while(std::getline(F0, St1)) {
+                        if(N7 < N4)
+                            Rvt0[N7] += R2 * R0;
+                        else
+                            Rvt2[N7 - N3] += R2 * R0;
 
-                // Line stream.
-                std::istringstream Ss1(St1);
+                        if(N7 != N5)
+                            R1 += R2 * Rv1[N7];
 
-                // Coordinates and entry.
-                Ss1 >> N1; --N1; // Row.
-                Ss1 >> N2; --N2; // Column.
-                Ss1 >> R0; // Entry.
+                        if(++N6 == Nv0[N5 + 1])
+                            break;
 
-                // Sparse check.
-                if(std::abs(R0) < real_tol)
-                    continue;
+                        N7 += Vr_Cv_N(Cv1);
+                    }
 
-                for(; N3 < N1; ++N3)
-                    Nv0[N3 + 1] = N4;
+                    Rvt0[N5] += R1;
+                }
+            });
+        }
 
-                Nv1[N4] = N2;
-                Rv0[N4] = R0;
 
-                ++N4;
-            }
+        /**
+         * @brief Multiplies a (SELL-C-σ) sparse matrix by a real_t*.
+         * Chunks are independent and processed in parallel, the rows of a chunk are accumulated together by the dispatched Dtc_RvtRvRvNN_0, see include/Dispatch.hpp.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv], rows.
+         * @param Nv1 Natural vector [Nv], chunk pointers.
+         * @param Nv2 Natural vector [Nv], columns.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mle_RvtNNvNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const index_t* Nv2, const value_t* Rv0, const scalar_t* Rv1) {
+            const natural_t N1 = (N0 + sell_chunk - 1) / sell_chunk;
+            const vectors_t<scalar_t>& Vt0 = Vct_0_Vt<scalar_t>();
 
-            // Last entries.
-            for(; N3 < N0; ++N3)
-                Nv0[N3 + 1] = N4;
+            #pragma omp parallel for schedule(dynamic, 64)
+            for(natural_t N2 = 0; N2 < N1; ++N2) {
+                alignas(64) scalar_t Rv2[sell_chunk];
 
-            // File closing.
-            F0.close();
+                if constexpr(std::is_same_v<value_t, scalar_t>) {
+                    alignas(64) scalar_t Rv3[SELL_TILE * sell_chunk];
+                    alignas(64) scalar_t Rv4[sell_chunk];
 
-            return {N0, Nv0, Nv1, Rv0};
+                    for(natural_t N4 = 0; N4 < sell_chunk; ++N4)
+                        Rv2[N4] = 0.0;
+
+                    // Gathered tiles of the chunk, multiplied by the dispatched kernel.
+                    for(natural_t N3 = Nv1[N2]; N3 < Nv1[N2 + 1]; N3 += SELL_TILE * sell_chunk) {
+                        const natural_t N4 = std::min<natural_t>(SELL_TILE * sell_chunk, Nv1[N2 + 1] - N3);
+
+                        for(natural_t N5 = 0; N5 < N4; ++N5)
+                            Rv3[N5] = Rv1[Nv2[N3 + N5]];
+
+                        Vt0.Dtc_RvtRvRvNN_0(Rv4, Rv0 + N3, Rv3, N4, sell_chunk);
+
+                        for(natural_t N5 = 0; N5 < sell_chunk; ++N5)
+                            Rv2[N5] += Rv4[N5];
+                    }
+                } else {
+                    for(natural_t N4 = 0; N4 < sell_chunk; ++N4)
+                        Rv2[N4] = 0.0;
+
+                    for(natural_t N3 = Nv1[N2]; N3 < Nv1[N2 + 1]; N3 += sell_chunk)
+                        for(natural_t N4 = 0; N4 < sell_chunk; ++N4)
+                            Rv2[N4] += Rv0[N3 + N4] * Rv1[Nv2[N3 + N4]];
+                }
+
+                for(natural_t N4 = 0; N4 < sell_chunk; ++N4)
+                    if(Nv0[N2 * sell_chunk + N4] < N0)
+                        Rvt0[Nv0[N2 * sell_chunk + N4]] += Rv2[N4];
+            }
         }
 
 
         /**
-         * @brief Multiplies a (CSC) sparse matrix by a real_t*.
+         * @brief Multiplies a (BCSR) sparse matrix with square blocks of size N1 by a real_t*, fixed-size microkernel.
          * 
          * @param Rvt0 Real vector [Rv], target [t].
          * @param N0 Natural number [N].
@@ -166,33 +3257,199 @@ namespace nass {
          * @param Nv1 Natural vector [Nv].
          * @param Rv0 Real vector [Rv].
          * @param Rv1 Real vector [Rv].
+         * @tparam N1 Block size.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
          */
-        void Mlc_RvtNNvNvRvRv_0(real_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const real_t* Rv1) {
-            for(natural_t N1 = 0; N1 < N0; ++N1) {
-                const real_t R0 = Rv1[N1];
+        template<natural_t N1, typename index_t, typename value_t, typename scalar_t>
+        static void Mlb_RvtNNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1) {
 
-                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
-                    Rvt0[Nv1[N2]] += Rv0[N2] * R0;
+            #pragma omp parallel for schedule(dynamic, 256)
+            for(natural_t N2 = 0; N2 < N0 / N1; ++N2) {
+                scalar_t Rv2[N1] = {};
+
+                for(natural_t N3 = Nv0[N2]; N3 < Nv0[N2 + 1]; ++N3) {
+                    const value_t* Rv3 = Rv0 + N3 * N1 * N1;
+                    const scalar_t* Rv4 = Rv1 + Nv1[N3] * N1;
+
+                    scalar_t Rv5[N1];
+
+                    for(natural_t N4 = 0; N4 < N1; ++N4)
+                        Rv5[N4] = Rv4[N4];
+
+                    for(natural_t N4 = 0; N4 < N1; ++N4)
+                        for(natural_t N5 = 0; N5 < N1; ++N5)
+                            Rv2[N4] += Rv3[N4 * N1 + N5] * Rv5[N5];
+                }
+
+                for(natural_t N4 = 0; N4 < N1; ++N4)
+                    Rvt0[N2 * N1 + N4] += Rv2[N4];
             }
         }
 
 
         /**
-         * @brief Multiplies a (CSR) sparse matrix by a real_t*.
+         * @brief Multiplies a (BCSR) sparse matrix with square blocks of size N1 by a real_t*.
+         * Dispatches to the microkernel of the block size, other sizes take the generic loop.
          * 
          * @param Rvt0 Real vector [Rv], target [t].
          * @param N0 Natural number [N].
+         * @param N1 Natural number [N], block size.
          * @param Nv0 Natural vector [Nv].
          * @param Nv1 Natural vector [Nv].
          * @param Rv0 Real vector [Rv].
          * @param Rv1 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlb_RvtNNNvNvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1) {
+            switch(N1) {
+                case 2: return Mlb_RvtNNvNvRvRv_0<2>(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+                case 3: return Mlb_RvtNNvNvRvRv_0<3>(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+                case 4: return Mlb_RvtNNvNvRvRv_0<4>(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+                case 6: return Mlb_RvtNNvNvRvRv_0<6>(Rvt0, N0, Nv0, Nv1, Rv0, Rv1);
+            }
+
+            // Generic loop, block rows are owned by a single thread.
+            #pragma omp parallel for schedule(dynamic, 256)
+            for(natural_t N2 = 0; N2 < N0 / N1; ++N2)
+                for(natural_t N3 = Nv0[N2]; N3 < Nv0[N2 + 1]; ++N3) {
+                    const value_t* Rv2 = Rv0 + N3 * N1 * N1;
+                    const scalar_t* Rv3 = Rv1 + Nv1[N3] * N1;
+
+                    for(natural_t N4 = 0; N4 < N1; ++N4) {
+                        scalar_t R0 = 0.0;
+
+                        for(natural_t N5 = 0; N5 < N1; ++N5)
+                            R0 += Rv2[N4 * N1 + N5] * Rv3[N5];
+
+                        Rvt0[N2 * N1 + N4] += R0;
+                    }
+                }
+        }
+
+
+        /**
+         * @brief Multiplies the rows N2 to N3 of a (DIA) sparse matrix by a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], diagonals.
+         * @param N2 Natural number [N], first row.
+         * @param N3 Natural number [N], last row, excluded.
+         * @param Iv0 Integer vector [Iv], offsets.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename value_t, typename scalar_t>
+        static inline void Mld_RvtNNNNIvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3, const integer_t* Iv0, const value_t* Rv0, const scalar_t* Rv1) {
+            for(natural_t N4 = 0; N4 < N1; ++N4) {
+                const integer_t I0 = Iv0[N4];
+
+                // Rows within the diagonal.
+                const natural_t N5 = std::max<integer_t>(static_cast<integer_t>(N2), -I0);
+                const natural_t N6 = std::min<integer_t>(static_cast<integer_t>(N3), static_cast<integer_t>(N0) - I0);
+
+                if(N5 >= N6)
+                    continue;
+
+                const natural_t N7 = N6 - N5;
+
+                scalar_t* Rv2 = Rvt0 + N5;
+                const value_t* Rv3 = Rv0 + N4 * N0 + N5;
+                const scalar_t* Rv4 = Rv1 + (static_cast<integer_t>(N5) + I0);
+
+                if constexpr(std::is_same_v<value_t, scalar_t>)
+                    Vct_0_Vt<scalar_t>().Fma_RvtRvRvN_0(Rv2, Rv3, Rv4, N7);
+                else
+                    for(natural_t N8 = 0; N8 < N7; ++N8)
+                        Rv2[N8] += Rv3[N8] * Rv4[N8];
+            }
+        }
+
+
+        /**
+         * @brief Multiplies a (DIA) sparse matrix by a real_t*.
+         * Rows are processed in parallel blocks, every diagonal is a contiguous update of the block by the dispatched Fma_RvtRvRvN_0, see include/Dispatch.hpp.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], diagonals.
+         * @param Iv0 Integer vector [Iv], offsets.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
          */
-        void Mlr_RvtNNvNvRvRv_0(real_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const real_t* Rv1) {
+        template<typename value_t, typename scalar_t>
+        void Mld_RvtNNIvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const natural_t& N1, const integer_t* Iv0, const value_t* Rv0, const scalar_t* Rv1) {
 
             #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0; ++N1)
-                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
-                    Rvt0[N1] += Rv0[N2] * Rv1[Nv1[N2]];
+            for(natural_t N2 = 0; N2 < N0; N2 += DIA_BLOCK)
+                Mld_RvtNNNNIvRvRv_0(Rvt0, N0, N1, N2, std::min<natural_t>(N2 + DIA_BLOCK, N0), Iv0, Rv0, Rv1);
+        }
+
+
+        /**
+         * @brief Multiplies a (DIA) sparse matrix by a real_t* and sketches the result.
+         * Every block of rows is sketched right after being completed, while still in cache.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], accumulates A * Rv1.
+         * @param Rvt1 Real vector [Rv], target [t], accumulates S * Rvt0.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], diagonals.
+         * @param Iv0 Integer vector [Iv], offsets.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N2 Natural number [N], sketch rows.
+         * @param Nv0 Natural vector [Nv], sketch.
+         * @param Nv1 Natural vector [Nv], sketch.
+         * @param Rv2 Real vector [Rv], sketch.
+         * @param Rvt2 Real vector [Rv], target [t], private sketches.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename value_t, typename scalar_t>
+        void Mdk_RvtRvtNNIvRvRvNNvNvRvRvt_0(scalar_t* Rvt0, scalar_t* Rvt1, const natural_t& N0, const natural_t& N1, const integer_t* Iv0, const value_t* Rv0, const scalar_t* Rv1, const natural_t& N2, const natural_t* Nv0, const natural_t* Nv1, const scalar_t* Rv2, std::vector<scalar_t>& Rvt2) {
+            #ifdef _OPENMP
+            const natural_t N3 = static_cast<natural_t>(omp_get_max_threads());
+            #else
+            const natural_t N3 = 1;
+            #endif
+
+            // Private sketches.
+            if(Rvt2.size() < N3 * N2)
+                Rvt2.resize(N3 * N2);
+
+            scalar_t* Rv3 = Rvt2.data();
+            std::fill_n(Rv3, N3 * N2, static_cast<scalar_t>(0.0));
+
+            #pragma omp parallel num_threads(N3)
+            {
+                #ifdef _OPENMP
+                const natural_t N4 = static_cast<natural_t>(omp_get_thread_num());
+                #else
+                const natural_t N4 = 0;
+                #endif
+
+                #pragma omp for
+                for(natural_t N5 = 0; N5 < N0; N5 += DIA_BLOCK) {
+                    const natural_t N6 = std::min<natural_t>(N5 + DIA_BLOCK, N0);
+
+                    Mld_RvtNNNNIvRvRv_0(Rvt0, N0, N1, N5, N6, Iv0, Rv0, Rv1);
+                    Sk_RvtNNNvNvRvRv_0(Rv3 + N4 * N2, N5, N6, Nv0, Nv1, Rv2, Rvt0);
+                }
+            }
+
+            // Reduction.
+            for(natural_t N4 = 0; N4 < N3; ++N4)
+                for(natural_t N5 = 0; N5 < N2; ++N5)
+                    Rvt1[N5] += Rv3[N4 * N2 + N5];
         }
 
 
@@ -206,12 +3463,16 @@ namespace nass {
          * @param Rv0 Real vector [Rv].
          * @param Rv1 Real vector [Rv].
          * @param Rv2 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
          */
-        void RMlc_RvtNNvNvRvRvRv_0(real_t* Rvt0, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const real_t* Rv1, const real_t* Rv2) {
+        template<typename index_t, typename value_t, typename scalar_t>
+        void RMlc_RvtNNvNvRvRvRv_0(scalar_t* Rvt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1, const scalar_t* Rv2) {
             Cp_RvtRvN_0(Rvt0, Rv2, N0);
 
             for(natural_t N1 = 0; N1 < N0; ++N1) {
-                const real_t R0 = Rv1[N1];
+                const scalar_t R0 = Rv1[N1];
 
                 for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
                     Rvt0[Nv1[N2]] -= Rv0[N2] * R0;
@@ -219,8 +3480,112 @@ namespace nass {
         }
 
 
+        /**
+         * @brief Multiplies a (CSC) sparse matrix by a row-major multivector.
+         * The matrix is read once, every entry updates all the vectors at once through the dispatched Axm_RvtRRvN_0, see include/Dispatch.hpp.
+         * 
+         * @param Rmt0 Real matrix [Rm], target [t], row-major. Size: N0 x N2.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rm0 Real matrix [Rm], row-major. Size: N1 x N2.
+         * @param N2 Natural number [N], vectors.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlm_RmtNNNvNvRvRmN_0(scalar_t* Rmt0, const natural_t& N0, const natural_t& N1, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rm0, const natural_t& N2) {
+            const vectors_t<scalar_t>& Vt0 = Vct_0_Vt<scalar_t>();
+
+            for(natural_t N3 = 0; N3 < N1; ++N3) {
+                const scalar_t* Rv1 = Rm0 + N3 * N2;
+
+                for(natural_t N4 = Nv0[N3]; N4 < Nv0[N3 + 1]; ++N4)
+                    Vt0.Axm_RvtRRvN_0(Rmt0 + Nv1[N4] * N2, Rv0[N4], Rv1, N2);
+            }
+        }
+
+
+        /**
+         * @brief Multiplies a square (CSC) sparse matrix by a row-major multivector, in parallel.
+         * Every thread owns a range of rows, as in Mlc_RvtNNvNvRvRvNNvNvRvt_0, and reads its part of the matrix once for all the vectors.
+         * 
+         * @param Rmt0 Real matrix [Rm], target [t], row-major. Size: N0 x N1.
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rm0 Real matrix [Rm], row-major. Size: N0 x N1.
+         * @param N1 Natural number [N], vectors.
+         * @param N2 Natural number [N], from Spl_NNvNv_NNvNv.
+         * @param Nv2 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Nv3 Natural vector [Nv], from Spl_NNvNv_NNvNv.
+         * @param Rvt0 Real vector [Rv], target [t], windows of the column splitting, see Mlp_RvtNNNvNvRvtF_0.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlm_RmtNNvNvRvRmNNNvNvRvt_0(scalar_t* Rmt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rm0, const natural_t& N1, const natural_t& N2, const natural_t* Nv2, const natural_t* Nv3, std::vector<scalar_t>& Rvt0) {
+            if(N2 == 1)
+                return Mlm_RmtNNNvNvRvRmN_0(Rmt0, N0, N0, Nv0, Nv1, Rv0, Rm0, N1);
+
+            const vectors_t<scalar_t>& Vt0 = Vct_0_Vt<scalar_t>();
+
+            // Column splitting.
+            if(Nv3[2 * N2] == 1)
+                return Mlp_RvtNNNvNvRvtF_0(Rmt0, N1, N2, Nv2, Nv3, Rvt0, [&](const natural_t& N3, scalar_t* Rmt1, const natural_t& N4) {
+                    const natural_t N5 = Nv2[N3], N6 = Nv2[N3 + 1];
+
+                    for(natural_t N7 = N5; N7 < N6; ++N7) {
+                        const scalar_t* Rv1 = Rm0 + N7 * N1;
+
+                        for(natural_t N8 = Nv0[N7]; N8 < Nv0[N7 + 1]; ++N8) {
+                            const natural_t N9 = Nv1[N8];
+
+                            if(N9 - N5 < N6 - N5)
+                                Vt0.Axm_RvtRRvN_0(Rmt0 + N9 * N1, Rv0[N8], Rv1, N1);
+                            else
+                                Vt0.Axm_RvtRRvN_0(Rmt1 + (N9 - N4) * N1, Rv0[N8], Rv1, N1);
+                        }
+                    }
+                });
+
+            #pragma omp parallel for schedule(static, 1) num_threads(N2)
+            for(natural_t N3 = 0; N3 < N2; ++N3) {
+                const index_t N4 = static_cast<index_t>(Nv2[N3]), N5 = static_cast<index_t>(Nv2[N3 + 1]);
+
+                for(natural_t N6 = Nv3[2 * N3]; N6 < Nv3[2 * N3 + 1]; ++N6) {
+                    const natural_t N7 = Nv0[N6], N8 = Nv0[N6 + 1];
+
+                    if(N7 == N8)
+                        continue;
+
+                    const scalar_t* Rv1 = Rm0 + N6 * N1;
+
+                    // Inner column.
+                    if(Nv1[N7] >= N4 && Nv1[N8 - 1] < N5) {
+                        for(natural_t N9 = N7; N9 < N8; ++N9)
+                            Vt0.Axm_RvtRRvN_0(Rmt0 + Nv1[N9] * N1, Rv0[N9], Rv1, N1);
+
+                        continue;
+                    }
+
+                    // Boundary column.
+                    for(natural_t N9 = std::lower_bound(Nv1 + N7, Nv1 + N8, N4) - Nv1; N9 < N8 && Nv1[N9] < N5; ++N9)
+                        Vt0.Axm_RvtRRvN_0(Rmt0 + Nv1[N9] * N1, Rv0[N9], Rv1, N1);
+                }
+            }
+        }
+
+
         /**
          * @brief Multiplies a (CSC) sparse matrix by a real_t*.
+         * Threads own ranges of columns and read them once for all the N2 vectors: tiles of Rm0 are packed row-major and accumulated, by Mlm_RmtNNNvNvRvRmN_0, into private row-major copies of Rmt0, which are then reduced in parallel.
+         * Meant for matrices with few rows, such as the sketch: threads are limited so that their copies and tiles never outgrow Rm0.
          * 
          * @param Rmt0 Real matrix [Rm], target [t]. Size: N0 x N2.
          * @param N0 Natural number [N].
@@ -230,50 +3595,281 @@ namespace nass {
          * @param Rv0 Real vector [Rv].
          * @param Rm0 Real matrix [Rm]. Size: N1 x N2.
          * @param N2 Natural number [N].
+         * @param Rvt0 Real vector [Rv], target [t], private copies and packed tiles, owned by the caller and grown as needed.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mlc_RmtNNNvNvRvRmNRvt_0(scalar_t* Rmt0, const natural_t& N0, const natural_t& N1, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rm0, const natural_t& N2, std::vector<scalar_t>& Rvt0) {
+            #ifdef _OPENMP
+            const natural_t N3 = std::max<natural_t>(1, std::min<natural_t>(static_cast<natural_t>(omp_get_max_threads()), N1 / (N0 + MULTI_BLOCK)));
+            #else
+            const natural_t N3 = 1;
+            #endif
+
+            // Private copies, row-major, and packed tiles.
+            if(Rvt0.size() < N3 * (N0 + MULTI_BLOCK) * N2)
+                Rvt0.resize(N3 * (N0 + MULTI_BLOCK) * N2);
+
+            #pragma omp parallel num_threads(N3)
+            {
+                #ifdef _OPENMP
+                const natural_t N4 = static_cast<natural_t>(omp_get_thread_num());
+                #else
+                const natural_t N4 = 0;
+                #endif
+
+                scalar_t* Rm1 = Rvt0.data() + N4 * (N0 + MULTI_BLOCK) * N2;
+                scalar_t* Rm2 = Rm1 + N0 * N2;
+
+                std::fill_n(Rm1, N0 * N2, static_cast<scalar_t>(0.0));
+
+                for(natural_t N5 = N1 * N4 / N3; N5 < N1 * (N4 + 1) / N3; N5 += MULTI_BLOCK) {
+                    const natural_t N6 = std::min<natural_t>(MULTI_BLOCK, N1 * (N4 + 1) / N3 - N5);
+
+                    for(natural_t N7 = 0; N7 < N2; ++N7)
+                        for(natural_t N8 = 0; N8 < N6; ++N8)
+                            Rm2[N8 * N2 + N7] = Rm0[N7 * N1 + N5 + N8];
+
+                    Mlm_RmtNNNvNvRvRmN_0(Rm1, N0, N6, Nv0 + N5, Nv1, Rv0, Rm2, N2);
+                }
+            }
+
+            // Reduction.
+            #pragma omp parallel for
+            for(natural_t N4 = 0; N4 < N2; ++N4)
+                for(natural_t N5 = 0; N5 < N0; ++N5) {
+                    scalar_t R0 = 0.0;
+
+                    for(natural_t N6 = 0; N6 < N3; ++N6)
+                        R0 += Rvt0[N6 * (N0 + MULTI_BLOCK) * N2 + N5 * N2 + N4];
+
+                    Rmt0[N4 * N0 + N5] += R0;
+                }
+        }
+
+
+        /**
+         * @brief Partitions a (CSR) sparse matrix for its matrix powers kernel.
+         * Rows are split into blocks sized for the cache, and every block is given, level by level, the rows it needs, so that its last level only depends on the first one.
+         * Ranges are contiguous hulls: overlapping and exact for banded matrices, redundant otherwise.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within rows.
+         * @tparam index_t Index type.
+         * @return std::tuple<natural_t, natural_t*> Blocks and their row ranges, powers_steps + 1 per block [Spw].
          */
-        void Mlc_RmtNNNvNvRvRmN_0(real_t* Rmt0, const natural_t& N0, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const real_t* Rm0, const natural_t& N2) {
+        template<typename index_t>
+        [[nodiscard]] std::tuple<natural_t, natural_t*> Pwp_NNvNv_NNv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1) {
+            #ifdef _OPENMP
+            const natural_t N1 = static_cast<natural_t>(omp_get_max_threads());
+            #else
+            const natural_t N1 = 1;
+            #endif
+
+            // Bandwidth, rows a level adds on each side.
+            natural_t N9 = 0;
+
+            #pragma omp parallel for reduction(max: N9)
+            for(natural_t N5 = 0; N5 < N0; ++N5)
+                if(Nv0[N5] < Nv0[N5 + 1])
+                    N9 = std::max<natural_t>(N9, std::max<natural_t>(N5 - std::min<natural_t>(N5, Nv1[Nv0[N5]]), Nv1[Nv0[N5 + 1] - 1] - std::min<natural_t>(N5, Nv1[Nv0[N5 + 1] - 1])));
+
+            // Rows per block, a block's entries and levels fitting in cache but at least four times its halo, at least a block per thread.
+            const natural_t N2 = std::max<natural_t>(Nv0[N0] / std::max<natural_t>(N0, 1), 1) * (sizeof(real_t) + sizeof(index_t)) + 2 * sizeof(real_t);
+            const natural_t N3 = std::max<natural_t>(1, std::min<natural_t>(std::max({POWERS_BYTES / N2, 4 * powers_steps * N9, static_cast<natural_t>(64)}), (N0 + N1 - 1) / N1));
+            const natural_t N4 = (N0 + N3 - 1) / N3;
+
+            natural_t* Nv2 = new natural_t[2 * (powers_steps + 1) * N4];
 
             #pragma omp parallel for
+            for(natural_t N5 = 0; N5 < N4; ++N5) {
+                natural_t* Nv3 = Nv2 + 2 * (powers_steps + 1) * N5;
+
+                Nv3[2 * powers_steps] = N5 * N3;
+                Nv3[2 * powers_steps + 1] = std::min(N0, (N5 + 1) * N3);
+
+                // Dependencies, level by level.
+                for(natural_t N6 = powers_steps; N6 > 0; --N6) {
+                    natural_t N7 = Nv3[2 * N6], N8 = Nv3[2 * N6 + 1];
+
+                    for(natural_t N10 = Nv3[2 * N6]; N10 < Nv3[2 * N6 + 1]; ++N10)
+                        if(Nv0[N10] < Nv0[N10 + 1]) {
+                            N7 = std::min<natural_t>(N7, Nv1[Nv0[N10]]);
+                            N8 = std::max<natural_t>(N8, Nv1[Nv0[N10 + 1] - 1] + 1);
+                        }
+
+                    Nv3[2 * (N6 - 1)] = N7;
+                    Nv3[2 * (N6 - 1) + 1] = N8;
+                }
+            }
+
+            return {N4, Nv2};
+        }
+
+
+        /**
+         * @brief Redundancy of a matrix powers partition, rows computed per row owned, over its levels.
+         * Hulls of irregular patterns grow past a block's halo, beyond powers_redundancy the plain operator is cheaper.
+         * 
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], from Pwp_NNvNv_NNv.
+         * @param Nv0 Natural vector [Nv], from Pwp_NNvNv_NNv.
+         * @return real_t Real number [R].
+         */
+        [[nodiscard]] real_t Pwr_NNNv_R(const natural_t& N0, const natural_t& N1, const natural_t* Nv0) {
+            natural_t N2 = 0;
+
+            #pragma omp parallel for reduction(+: N2)
+            for(natural_t N3 = 0; N3 < N1; ++N3)
+                for(natural_t N4 = 1; N4 <= powers_steps; ++N4)
+                    N2 += Nv0[2 * ((powers_steps + 1) * N3 + N4) + 1] - Nv0[2 * ((powers_steps + 1) * N3 + N4)];
+
+            return static_cast<real_t>(N2) / (powers_steps * std::max<natural_t>(N0, 1));
+        }
+
+
+        /**
+         * @brief Scaling of the matrix powers, the infinity norm of a (CSR) sparse matrix.
+         * It bounds the spectral radius, so that the scaled powers neither overflow nor grow apart by the norm at every level.
+         * 
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @tparam index_t Index type.
+         * @return real_t Real number [R], one for a zero matrix.
+         */
+        template<typename index_t>
+        [[nodiscard]] real_t Pws_NNvRv_R(const natural_t& N0, const index_t* Nv0, const real_t* Rv0) {
+            real_t R0 = 0.0;
+
+            #pragma omp parallel for reduction(max: R0)
+            for(natural_t N1 = 0; N1 < N0; ++N1) {
+                real_t R1 = 0.0;
+
+                for(natural_t N2 = Nv0[N1]; N2 < Nv0[N1 + 1]; ++N2)
+                    R1 += std::abs(Rv0[N2]);
+
+                R0 = std::max(R0, R1);
+            }
+
+            return R0 > 0.0 ? R0 : 1.0;
+        }
+
+
+        /**
+         * @brief Matrix powers kernel, computes the Newton basis p_1, ..., p_N1 of Rv1 = p_0 on a (CSR) sparse matrix, p_(j + 1) = (A - Rv2[j] * I) * p_j / R0.
+         * Every block computes its levels in private buffers, redundantly on the overlaps, so that its rows of the matrix are loaded once for all the powers.
+         * Every level is scaled by R0, from Pws_NNvRv_R, so that the basis keeps the magnitude of Rv1, and shifted by a Ritz value, so that it does not collapse onto the dominant eigenvectors as the monomial one does.
+         * 
+         * @param Rmt0 Real matrix [Rm], target [t], overwritten. Size: N0 x N1, the j-th column holds p_(j + 1).
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param Rv2 Real vector [Rv], shifts, N1 of them, zeros giving the monomial basis.
+         * @param N1 Natural number [N], powers, at most powers_steps.
+         * @param N2 Natural number [N], from Pwp_NNvNv_NNv.
+         * @param Nv2 Natural vector [Nv], from Pwp_NNvNv_NNv.
+         * @param R0 Real number [R], scaling, from Pws_NNvRv_R.
+         * @tparam index_t Index type.
+         * @tparam value_t Value type, accumulated in scalar_t.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename index_t, typename value_t, typename scalar_t>
+        void Mpk_RmtNNvNvRvRvRvNNNvR_0(scalar_t* Rmt0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const value_t* Rv0, const scalar_t* Rv1, const scalar_t* Rv2, const natural_t& N1, const natural_t& N2, const natural_t* Nv2, const scalar_t& R0) {
+            #ifndef NDEBUG // Integrity check.
+            assert(N1 <= powers_steps);
+            assert(R0 > 0.0);
+            #endif
+
+            const scalar_t R1 = 1.0 / R0;
+
+            // Widest block.
+            natural_t N8 = 0;
+
             for(natural_t N3 = 0; N3 < N2; ++N3)
-                for(natural_t N4 = 0; N4 < N1; ++N4) {
-                    const real_t R0 = Rm0[N3 * N1 + N4];
+                N8 = std::max(N8, Nv2[2 * (powers_steps + 1) * N3 + 1] - Nv2[2 * (powers_steps + 1) * N3]);
+
+            #pragma omp parallel
+            {
+                scalar_t* Rv3 = new scalar_t[N8];
+                scalar_t* Rv4 = new scalar_t[N8];
 
-                    for(natural_t N5 = Nv0[N4]; N5 < Nv0[N4 + 1]; ++N5)
-                        Rmt0[N3 * N0 + Nv1[N5]] += Rv0[N5] * R0;
+                #pragma omp for schedule(static)
+                for(natural_t N3 = 0; N3 < N2; ++N3) {
+                    const natural_t* Nv3 = Nv2 + 2 * (powers_steps + 1) * N3;
+                    const natural_t N4 = Nv3[0], N6 = Nv3[2 * powers_steps], N7 = Nv3[2 * powers_steps + 1];
+
+                    for(natural_t N5 = 1; N5 <= N1; ++N5) {
+                        const scalar_t* Rv5 = N5 == 1 ? Rv1 + N4 : Rv3;
+                        const scalar_t R3 = Rv2[N5 - 1];
+                        const natural_t N9 = Nv3[2 * N5], N10 = Nv3[2 * N5 + 1];
+                        scalar_t* Rv6 = Rmt0 + (N5 - 1) * N0;
+
+                        // Level, on the rows needed by the next ones, owned rows are also stored; hulls are nested, the row itself is in the previous level.
+                        for(natural_t N11 = N9; N11 < N10; ++N11) {
+                            const natural_t N12 = Nv0[N11], N13 = Nv0[N11 + 1];
+                            scalar_t R2 = -R3 * Rv5[N11 - N4];
+
+                            for(natural_t N14 = N12; N14 < N13; ++N14)
+                                R2 += Rv0[N14] * Rv5[Nv1[N14] - N4];
+
+                            R2 *= R1;
+                            Rv4[N11 - N4] = R2;
+
+                            if(N11 >= N6 && N11 < N7)
+                                Rv6[N11] = R2;
+                        }
+
+                        std::swap(Rv3, Rv4);
+                    }
                 }
+
+                delete[] Rv3;
+                delete[] Rv4;
+            }
         }
 
 
         /**
-         * @brief (CSC) sparse embedding.
+         * @brief (CSC) sparse embedding, drawn from a generator seeded with N2, so that equal seeds give equal embeddings.
          * 
          * @param N0 Natural number [N].
          * @param N1 Natural number [N].
+         * @param N2 Natural number [N], seed.
+         * @tparam scalar_t Scalar type.
          * @return std::tuple<natural_t*, natural_t*, real_t*> 
          */
-        [[nodiscard]] std::tuple<natural_t*, natural_t*, real_t*> Sec_NN_NvNvRv(const natural_t& N0, const natural_t& N1) {
-            std::srand(std::time(nullptr));
-            
-            const natural_t N2 = 2 * (N0 + 1);
-            const natural_t N3 = static_cast<natural_t>(std::ceil(2.0 * std::log(N0 + 1.0)));
+        template<typename scalar_t>
+        [[nodiscard]] std::tuple<natural_t*, natural_t*, scalar_t*> Sec_NNN_NvNvRv(const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+            std::mt19937 G0(static_cast<std::mt19937::result_type>(N2));
+
+            const natural_t N3 = 2 * (N0 + 1);
+            const natural_t N4 = static_cast<natural_t>(std::ceil(2.0 * std::log(N0 + 1.0)));
+
+            const scalar_t R0 = 1.0 / std::sqrt(static_cast<scalar_t>(N3)), R1 = -R0;
 
-            const real_t R0 = 1.0 / std::sqrt(static_cast<real_t>(N2)), R1 = -R0;
+            std::uniform_int_distribution<natural_t> D0(0, N3 - 1), D1(0, 1);
 
             natural_t* Nv0 = new natural_t[N1 + 1];
-            natural_t* Nv1 = new natural_t[N3 * N1];
-            real_t* Rv0 = new real_t[N3 * N1];
+            natural_t* Nv1 = new natural_t[N4 * N1];
+            scalar_t* Rv0 = new scalar_t[N4 * N1];
             
             #pragma omp parallel for
-            for(natural_t N4 = 0; N4 < N1 + 1; ++N4)
-                Nv0[N4] = N4 * N3;
+            for(natural_t N5 = 0; N5 < N1 + 1; ++N5)
+                Nv0[N5] = N5 * N4;
 
             // Checks.
-            bool* Bv0 = new bool[N2];
+            bool* Bv0 = new bool[N3]();
             bool B0 = true;
 
             do {
-                for(natural_t N4 = 0; N4 < N1; ++N4)
-                    for(natural_t N5 = 0; N5 < N3; ++N5) {
+                for(natural_t N5 = 0; N5 < N1; ++N5)
+                    for(natural_t N6 = 0; N6 < N4; ++N6) {
 
                         // Check.
                         bool B1;
@@ -281,31 +3877,31 @@ namespace nass {
                         do {
                             
                             // Row index.
-                            Nv1[N4 * N3 + N5] = std::rand() % N2;
+                            Nv1[N5 * N4 + N6] = D0(G0);
 
                             // Check.
                             B1 = false;
-                            for(natural_t N6 = 0; N6 < N5; ++N6)
-                                if(Nv1[N4 * N3 + N5] == Nv1[N4 * N3 + N6]) {
+                            for(natural_t N7 = 0; N7 < N6; ++N7)
+                                if(Nv1[N5 * N4 + N6] == Nv1[N5 * N4 + N7]) {
                                     B1 = true; break;
                                 }
 
                         } while(B1);
 
                         // Check.
-                        Bv0[Nv1[N4 * N3 + N5]] = true;
+                        Bv0[Nv1[N5 * N4 + N6]] = true;
 
                         // // Value.
-                        // do { Rv0[N4 * N3 + N5] = (static_cast<real_t>(std::rand()) / RAND_MAX - 0.5) * R0; } while(std::abs(Rv0[N4 * N3 + N5]) <= real_tol);
+                        // do { Rv0[N5 * N4 + N6] = (static_cast<real_t>(std::rand()) / RAND_MAX - 0.5) * R0; } while(std::abs(Rv0[N5 * N4 + N6]) <= real_tol);
 
                         // Value.
-                        Rv0[N4 * N3 + N5] = (std::rand() % 2) ? R0 : R1;
+                        Rv0[N5 * N4 + N6] = D1(G0) ? R0 : R1;
                     }
 
                 // Check.
                 B0 = false;
-                for(natural_t N4 = 0; N4 < N2; ++N4)
-                    if(!Bv0[N4]) {
+                for(natural_t N5 = 0; N5 < N3; ++N5)
+                    if(!Bv0[N5]) {
                         B0 = true; break;
                     }
 
@@ -316,5 +3912,95 @@ namespace nass {
             return {Nv0, Nv1, Rv0};
         }
 
+
+        // Instantiations.
+
+        #define NASS_SPARSE_INSTANTIATE(index_t) \
+            template std::tuple<natural_t, index_t*, index_t*, real_t*, index_t*, index_t*, real_t*> Spcr_StBB_NNvNvRvNvNvRv(const std::string&, const bool&, const bool&); \
+            template std::tuple<natural_t, index_t*, index_t*, real_t*> Spc_St_NNvNvRv(const std::string&); \
+            template std::tuple<natural_t, index_t*, index_t*, real_t*> Spr_St_NNvNvRv(const std::string&); \
+            template std::tuple<natural_t, index_t*, index_t*, real_t*> Sps_St_NNvNvRv(const std::string&); \
+            template std::tuple<index_t*, index_t*, real_t*> Cmp_NNNvNvRv_NvNvRv(const natural_t&, const natural_t&, const index_t*, const index_t*, const real_t*); \
+            template std::tuple<index_t*, index_t*, real_t*> Tr_NNvNvRv_NvNvRv(const natural_t&, const index_t*, const index_t*, const real_t*); \
+            template index_t* Nrw_NvN_Nv(const natural_t*, const natural_t&); \
+            template std::tuple<unsigned char*, natural_t> Dlt_NNvNv_CvN(const natural_t&, const index_t*, const index_t*); \
+            template std::tuple<natural_t*, natural_t*> Ptn_NNvNvNNvNvBB_NvNv(const natural_t&, const index_t*, const index_t*, const natural_t&, const natural_t*, const natural_t*, const bool&, const bool&); \
+            template derived_t Drv_RvNNvNvDLNNvB_D(real_t*, const natural_t&, const index_t*, const index_t*, const derived_t*, const layout_t&, const natural_t&, const natural_t*, const bool&); \
+            template std::tuple<natural_t, natural_t*, natural_t*> Spl_NNvNv_NNvNv(const natural_t&, const index_t*, const index_t*); \
+            template std::tuple<natural_t, natural_t*, natural_t*> Sps_NNvNvCv_NNvNv(const natural_t&, const index_t*, const index_t*, const unsigned char*); \
+            template std::tuple<natural_t*, natural_t*, index_t*, real_t*> Sel_NNvNvRv_NvNvNvRv(const natural_t&, const index_t*, const index_t*, const real_t*); \
+            template natural_t Blk_NNvNv_N(const natural_t&, const index_t*, const index_t*); \
+            template std::tuple<index_t*, index_t*, real_t*> Bcr_NNNvNvRv_NvNvRv(const natural_t&, const natural_t&, const index_t*, const index_t*, const real_t*); \
+            template std::tuple<natural_t, integer_t*, real_t*> Dia_NNvNvRv_NIvRv(const natural_t&, const index_t*, const index_t*, const real_t*); \
+            template natural_t* Rcm_NNvNv_Nv(const natural_t&, const index_t*, const index_t*); \
+            template std::tuple<index_t*, index_t*, real_t*> Prm_NNvNvRvNvB_NvNvRv(const natural_t&, const index_t*, const index_t*, const real_t*, const natural_t*, const bool&); \
+            template std::tuple<natural_t, natural_t> Bnd_NNvNv_NN(const natural_t&, const index_t*, const index_t*); \
+            template std::tuple<natural_t, natural_t*> Pwp_NNvNv_NNv(const natural_t&, const index_t*, const index_t*); \
+            template real_t Pws_NNvRv_R(const natural_t&, const index_t*, const real_t*);
+
+        #define NASS_PRODUCT_INSTANTIATE(index_t, value_t, scalar_t) \
+            template void Mlc_RvtNNvNvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*); \
+            template void Mlc_RvtNNvNvRvRvNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&); \
+            template void Mlk_RvtRvtNNvNvRvRvNNvNvNNvNvRvRvt_0(scalar_t*, scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, const natural_t&, const natural_t*, const natural_t*, const scalar_t*, std::vector<scalar_t>&); \
+            template void Mlr_RvtNNvNvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*); \
+            template void Mls_RvtNNvNvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*); \
+            template void Mls_RvtNNvNvRvRvNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&); \
+            template void Mlc_RvtNNvCvRvRv_0(scalar_t*, const natural_t&, const index_t*, const unsigned char*, const value_t*, const scalar_t*); \
+            template void Mls_RvtNNvCvRvRv_0(scalar_t*, const natural_t&, const index_t*, const unsigned char*, const value_t*, const scalar_t*); \
+            template void Mls_RvtNNvCvRvRvNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const unsigned char*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&); \
+            template void Mle_RvtNNvNvNvRvRv_0(scalar_t*, const natural_t&, const natural_t*, const natural_t*, const index_t*, const value_t*, const scalar_t*); \
+            template void Mlb_RvtNNNvNvRvRv_0(scalar_t*, const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*); \
+            template void RMlc_RvtNNvNvRvRvRv_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const scalar_t*); \
+            template void Mlm_RmtNNNvNvRvRmN_0(scalar_t*, const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&); \
+            template void Mlm_RmtNNvNvRvRmNNNvNvRvt_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t*, const natural_t*, std::vector<scalar_t>&); \
+            template void Mlc_RmtNNNvNvRvRmNRvt_0(scalar_t*, const natural_t&, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const natural_t&, std::vector<scalar_t>&); \
+            template void Mpk_RmtNNvNvRvRvRvNNNvR_0(scalar_t*, const natural_t&, const index_t*, const index_t*, const value_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t*, const scalar_t&);
+
+        #define NASS_DIAGONAL_INSTANTIATE(value_t, scalar_t) \
+            template void Mld_RvtNNIvRvRv_0(scalar_t*, const natural_t&, const natural_t&, const integer_t*, const value_t*, const scalar_t*); \
+            template void Mdk_RvtRvtNNIvRvRvNNvNvRvRvt_0(scalar_t*, scalar_t*, const natural_t&, const natural_t&, const integer_t*, const value_t*, const scalar_t*, const natural_t&, const natural_t*, const natural_t*, const scalar_t*, std::vector<scalar_t>&);
+
+        #define NASS_SCALAR_INSTANTIATE(scalar_t) \
+            template void Prm_RvtRvNvN_0(scalar_t*, const scalar_t*, const natural_t*, const natural_t&); \
+            template void Ipr_RvtRvNvN_0(scalar_t*, const scalar_t*, const natural_t*, const natural_t&); \
+            template std::tuple<natural_t*, natural_t*, scalar_t*> Sec_NNN_NvNvRv(const natural_t&, const natural_t&, const natural_t&); \
+            template scalar_t* Nrw_RvN_Rv(const real_t*, const natural_t&);
+
+        NASS_SPARSE_INSTANTIATE(natural_t)
+        NASS_SPARSE_INSTANTIATE(natural32_t)
+
+        // Values, as stored, and scalars, as solved.
+
+        NASS_PRODUCT_INSTANTIATE(natural_t, double, double)
+        NASS_PRODUCT_INSTANTIATE(natural32_t, double, double)
+        NASS_PRODUCT_INSTANTIATE(natural_t, float, double)
+        NASS_PRODUCT_INSTANTIATE(natural32_t, float, double)
+        NASS_PRODUCT_INSTANTIATE(natural_t, double, float)
+        NASS_PRODUCT_INSTANTIATE(natural32_t, double, float)
+        NASS_PRODUCT_INSTANTIATE(natural_t, float, float)
+        NASS_PRODUCT_INSTANTIATE(natural32_t, float, float)
+
+        NASS_DIAGONAL_INSTANTIATE(double, double)
+        NASS_DIAGONAL_INSTANTIATE(float, double)
+        NASS_DIAGONAL_INSTANTIATE(double, float)
+        NASS_DIAGONAL_INSTANTIATE(float, float)
+
+        NASS_SCALAR_INSTANTIATE(double)
+        NASS_SCALAR_INSTANTIATE(float)
+
+        template void Rfs_RvtNNvNvRv_0(real_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*);
+
+        #ifndef NEON32 // value32_t differs from real_t.
+        template void Rfs_RvtNNvNvRv_0(value32_t*, const natural_t&, const natural_t*, const natural_t*, const real_t*);
+
+        template derived_t Drv_RvNNvNvDLNNvB_D(value32_t*, const natural_t&, const natural_t*, const natural_t*, const derived_t*, const layout_t&, const natural_t&, const natural_t*, const bool&);
+        template derived_t Drv_RvNNvNvDLNNvB_D(value32_t*, const natural_t&, const natural32_t*, const natural32_t*, const derived_t*, const layout_t&, const natural_t&, const natural_t*, const bool&);
+        #endif
+
+        #undef NASS_SPARSE_INSTANTIATE
+        #undef NASS_PRODUCT_INSTANTIATE
+        #undef NASS_DIAGONAL_INSTANTIATE
+        #undef NASS_SCALAR_INSTANTIATE
+
     }
 }
\ No newline at end of file
@@ -0,0 +1,427 @@
+/**
+ * @file NASS_Tuner.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Tuner.hpp implementations.
+ * @date 2024-12-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#ifndef NVERBOSE
+#include <print>
+#endif
+
+#include "../include/Sparse.hpp"
+#include "../include/Cache.hpp"
+#include "../include/Dispatch.hpp"
+#include "../include/Tuner.hpp"
+
+// Benchmark: untimed and timed products per candidate.
+#define TUNE_WARMUP 1
+#define TUNE_ITERATIONS 5
+
+// Candidates: row length deviation, relative to the mean, above which (SELL-C-σ) is skipped.
+#define TUNE_DEVIATION 4.0
+
+// Candidates: bandwidth below which delta-encoded indices fit in two bytes.
+#define TUNE_DELTA (1 << 14)
+
+// Fused candidates: subspace dimension the sketch is sized for.
+#define TUNE_SUBSPACE 64
+
+namespace nass {
+    namespace internal {
+
+        static constexpr std::string_view kernel_names[] = {"split", "csr", "sell", "bcsr", "dia", "delta", "symmetric", "symmetric_delta"};
+
+
+        /**
+         * @brief Name of a kernel_t.
+         *
+         * @param K0 Kernel [K].
+         * @return std::string_view String [St].
+         */
+        [[nodiscard]] std::string_view Nm_K_St(const kernel_t& K0) {
+            return kernel_names[static_cast<std::uint32_t>(K0)];
+        }
+
+
+        /**
+         * @brief Structural statistics of a (CSC) sparse matrix.
+         *
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv], sorted within columns.
+         * @param B0 Boolean [B], symmetric (lower) storage.
+         * @tparam index_t Index type.
+         * @return statistics_t Statistics [S].
+         */
+        template<typename index_t>
+        [[nodiscard]] statistics_t Sts_NNvNvB_S(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const bool& B0) {
+            const natural_t N1 = Nv0[N0];
+
+            // Row lengths.
+            natural_t* Nv2 = new natural_t[N0]();
+
+            for(natural_t N2 = 0; N2 < N1; ++N2)
+                ++Nv2[Nv1[N2]];
+
+            const real_t R0 = static_cast<real_t>(N1) / N0;
+            real_t R1 = 0.0;
+
+            #pragma omp parallel for reduction(+: R1)
+            for(natural_t N2 = 0; N2 < N0; ++N2)
+                R1 += (Nv2[N2] - R0) * (Nv2[N2] - R0);
+
+            delete[] Nv2;
+
+            const auto [N2, N3] = Bnd_NNvNv_NN(N0, Nv0, Nv1);
+
+            return {N0, N1, R0, std::sqrt(R1 / N0), N2, B0 ? 1 : Blk_NNvNv_N(N0, Nv0, Nv1)};
+        }
+
+
+        /**
+         * @brief Fingerprint of the structure of a (CSC) sparse matrix, together with the setting it is multiplied in.
+         * The setting covers the threads, the instruction set level and the compile-time formats the candidates are built with.
+         *
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param B0 Boolean [B], symmetric (lower) storage.
+         * @tparam index_t Index type.
+         * @return std::uint64_t Fingerprint.
+         */
+        template<typename index_t>
+        [[nodiscard]] std::uint64_t Fp_NNvNvB_N(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const bool& B0) {
+            #ifdef _OPENMP
+            const std::uint64_t N1 = static_cast<std::uint64_t>(omp_get_max_threads());
+            #else
+            const std::uint64_t N1 = 1;
+            #endif
+
+            // Compile-time formats.
+            std::uint64_t N2 = 0;
+
+            #ifdef DELTA_INDICES
+            N2 |= 1;
+            #endif
+
+            #ifdef SELL_FORMAT
+            N2 |= 2;
+            #endif
+
+            #ifdef SINGLE_VALUES
+            N2 |= 4;
+            #endif
+
+            #ifdef RCM_ORDERING
+            N2 |= 8;
+            #endif
+
+            #ifdef MEMORY_PRIORITY
+            N2 |= 16;
+            #endif
+
+            const std::uint64_t Nv2[] = {
+                N0, Nv0[N0], sizeof(index_t), sizeof(real_t), B0, N1,
+                static_cast<std::uint64_t>(Isa_0_I()), N2, sell_chunk, sell_sigma, dia_diagonals, split_redundancy,
+                Ck_CvN_N(reinterpret_cast<const unsigned char*>(Nv0), (N0 + 1) * sizeof(index_t)),
+                Ck_CvN_N(reinterpret_cast<const unsigned char*>(Nv1), Nv0[N0] * sizeof(index_t))
+            };
+
+            return Ck_CvN_N(reinterpret_cast<const unsigned char*>(Nv2), sizeof(Nv2));
+        }
+
+
+        /**
+         * @brief Times a product, returning its fastest run.
+         *
+         * @param Op0 Product, accumulating into its first argument.
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam op_t Product type.
+         * @return real_t Real number [R], seconds.
+         */
+        template<typename op_t>
+        [[nodiscard]] static real_t Bm_OpRvtRvN_R(const op_t& Op0, real_t* Rvt0, const real_t* Rv0, const natural_t& N0) {
+            real_t R0 = std::numeric_limits<real_t>::max();
+
+            for(natural_t N1 = 0; N1 < TUNE_WARMUP + TUNE_ITERATIONS; ++N1) {
+                std::fill_n(Rvt0, N0, 0.0);
+
+                const auto T0 = std::chrono::high_resolution_clock::now();
+                Op0(Rvt0, Rv0);
+                const auto T1 = std::chrono::high_resolution_clock::now();
+
+                if(N1 >= TUNE_WARMUP)
+                    R0 = std::min(R0, std::chrono::duration<real_t>(T1 - T0).count());
+            }
+
+            return R0;
+        }
+
+
+        /**
+         * @brief Micro-benchmarks the candidate products of a (CSC) sparse matrix and picks the fastest.
+         * Candidates are chosen from the statistics, every one is built, timed on the matrix and released.
+         * With MEMORY_PRIORITY, general storage is only multiplied by layouts with a fused product and sketch, parallel (CSC) and (DIA), timed fused as the solver runs them.
+         *
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param B0 Boolean [B], symmetric (lower) storage.
+         * @param S0 Statistics [S], from Sts_NNvNvB_S.
+         * @tparam index_t Index type.
+         * @return std::tuple<kernel_t, real_t> Kernel [K] and its time per product, in seconds.
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<kernel_t, real_t> Tun_NNvNvRvBS_KR(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const bool& B0, const statistics_t& S0) {
+            real_t* Rv1 = new real_t[N0];
+            real_t* Rv2 = new real_t[N0];
+
+            #pragma omp parallel for
+            for(natural_t N1 = 0; N1 < N0; ++N1)
+                Rv1[N1] = 1.0 + static_cast<real_t>(N1 % 7) / 7.0;
+
+            // Candidates' windows and private sketches, for the tuning.
+            std::vector<real_t> Rv7;
+
+            kernel_t K0 = B0 ? kernel_t::symmetric : kernel_t::split;
+            real_t R0 = std::numeric_limits<real_t>::max();
+
+            #ifndef NVERBOSE
+            std::println("--- Tuning.");
+            std::println("Statistics: {}, {}, {:.3e} ± {:.3e}, {}, {}", S0.N0, S0.N1, S0.R0, S0.R1, S0.N2, S0.N3);
+            std::println("Timings:");
+            #endif
+
+            // Candidate.
+            const auto Cn_KR_0 = [&](const kernel_t& K1, const real_t& R1) {
+                #ifndef NVERBOSE
+                std::println("\t{}: {:.3e} s", Nm_K_St(K1), R1);
+                #endif
+
+                if(R1 < R0) {
+                    K0 = K1;
+                    R0 = R1;
+                }
+            };
+
+            if(B0) {
+
+                // Symmetric (lower) storage, parallel.
+                {
+                    const auto [N1, Nv2, Nv3] = Sps_NNvNvCv_NNvNv(N0, Nv0, Nv1, nullptr);
+                    Cn_KR_0(kernel_t::symmetric, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv3) { Mls_RvtNNvNvRvRvNNvNvRvt_0(Rvt0, N0, Nv0, Nv1, Rv0, Rv3, N1, Nv2, Nv3, Rv7); }, Rv2, Rv1, N0));
+                    delete[] Nv2; delete[] Nv3;
+                }
+
+                if(S0.N2 < TUNE_DELTA) {
+                    const auto [Cv0, N1] = Dlt_NNvNv_CvN(N0, Nv0, Nv1);
+                    const auto [N2, Nv2, Nv3] = Sps_NNvNvCv_NNvNv(N0, Nv0, Nv1, Cv0);
+                    Cn_KR_0(kernel_t::symmetric_delta, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv3) { Mls_RvtNNvCvRvRvNNvNvRvt_0(Rvt0, N0, Nv0, Cv0, Rv0, Rv3, N2, Nv2, Nv3, Rv7); }, Rv2, Rv1, N0));
+                    delete[] Cv0; delete[] Nv2; delete[] Nv3;
+                }
+            } else {
+
+                #ifdef MEMORY_PRIORITY
+
+                // Sketch, sized as the solver's for TUNE_SUBSPACE.
+                const auto [Nv4, Nv5, Rv4] = Sec_NNN_NvNvRv<real_t>(TUNE_SUBSPACE, N0, sketch_seed);
+                const natural_t N2 = 2 * (TUNE_SUBSPACE + 1);
+                real_t* Rv5 = new real_t[N2]();
+
+                // Parallel (CSC), fused.
+                {
+                    const auto [N1, Nv2, Nv3] = Spl_NNvNv_NNvNv(N0, Nv0, Nv1);
+                    Cn_KR_0(kernel_t::split, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv3) { Mlk_RvtRvtNNvNvRvRvNNvNvNNvNvRvRvt_0(Rvt0, Rv5, N0, Nv0, Nv1, Rv0, Rv3, N1, Nv2, Nv3, N2, Nv4, Nv5, Rv4, Rv7); }, Rv2, Rv1, N0));
+                    delete[] Nv2; delete[] Nv3;
+                }
+
+                // (DIA), short rows, fused.
+                if(S0.R0 <= dia_diagonals) {
+                    const auto [N1, Iv0, Rv3] = Dia_NNvNvRv_NIvRv(N0, Nv0, Nv1, Rv0);
+
+                    if(N1 > 0)
+                        Cn_KR_0(kernel_t::dia, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv6) { Mdk_RvtRvtNNIvRvRvNNvNvRvRvt_0(Rvt0, Rv5, N0, N1, Iv0, Rv3, Rv6, N2, Nv4, Nv5, Rv4, Rv7); }, Rv2, Rv1, N0));
+
+                    delete[] Iv0; delete[] Rv3;
+                }
+
+                delete[] Nv4; delete[] Nv5; delete[] Rv4;
+                delete[] Rv5;
+
+                #else
+
+                // Parallel (CSC).
+                {
+                    const auto [N1, Nv2, Nv3] = Spl_NNvNv_NNvNv(N0, Nv0, Nv1);
+                    Cn_KR_0(kernel_t::split, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv3) { Mlc_RvtNNvNvRvRvNNvNvRvt_0(Rvt0, N0, Nv0, Nv1, Rv0, Rv3, N1, Nv2, Nv3, Rv7); }, Rv2, Rv1, N0));
+                    delete[] Nv2; delete[] Nv3;
+                }
+
+                // (CSR).
+                {
+                    const auto [Nv2, Nv3, Rv3] = Tr_NNvNvRv_NvNvRv(N0, Nv0, Nv1, Rv0);
+                    Cn_KR_0(kernel_t::csr, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv4) { Mlr_RvtNNvNvRvRv_0(Rvt0, N0, Nv2, Nv3, Rv3, Rv4); }, Rv2, Rv1, N0));
+                    delete[] Nv2; delete[] Nv3; delete[] Rv3;
+                }
+
+                // (SELL-C-σ), regular enough rows.
+                if(S0.R1 <= TUNE_DEVIATION * S0.R0) {
+                    const auto [Nv2, Nv3, Nv4, Rv3] = Sel_NNvNvRv_NvNvNvRv(N0, Nv0, Nv1, Rv0);
+                    Cn_KR_0(kernel_t::sell, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv4) { Mle_RvtNNvNvNvRvRv_0(Rvt0, N0, Nv2, Nv3, Nv4, Rv3, Rv4); }, Rv2, Rv1, N0));
+                    delete[] Nv2; delete[] Nv3; delete[] Nv4; delete[] Rv3;
+                }
+
+                // (BCSR), blocked matrices.
+                if(S0.N3 > 1) {
+                    const auto [Nv2, Nv3, Rv3] = Bcr_NNNvNvRv_NvNvRv(N0, S0.N3, Nv0, Nv1, Rv0);
+                    Cn_KR_0(kernel_t::bcsr, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv4) { Mlb_RvtNNNvNvRvRv_0(Rvt0, N0, S0.N3, Nv2, Nv3, Rv3, Rv4); }, Rv2, Rv1, N0));
+                    delete[] Nv2; delete[] Nv3; delete[] Rv3;
+                }
+
+                // (DIA), short rows.
+                if(S0.R0 <= dia_diagonals) {
+                    const auto [N1, Iv0, Rv3] = Dia_NNvNvRv_NIvRv(N0, Nv0, Nv1, Rv0);
+
+                    if(N1 > 0)
+                        Cn_KR_0(kernel_t::dia, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv4) { Mld_RvtNNIvRvRv_0(Rvt0, N0, N1, Iv0, Rv3, Rv4); }, Rv2, Rv1, N0));
+
+                    delete[] Iv0; delete[] Rv3;
+                }
+
+                // Delta-encoded (CSC), banded matrices.
+                if(S0.N2 < TUNE_DELTA) {
+                    const auto [Cv0, N1] = Dlt_NNvNv_CvN(N0, Nv0, Nv1);
+                    Cn_KR_0(kernel_t::delta, Bm_OpRvtRvN_R([&](real_t* Rvt0, const real_t* Rv3) { Mlc_RvtNNvCvRvRv_0(Rvt0, N0, Nv0, Cv0, Rv0, Rv3); }, Rv2, Rv1, N0));
+                    delete[] Cv0;
+                }
+
+                #endif
+            }
+
+            #ifndef NVERBOSE
+            std::println("Kernel: {}", Nm_K_St(K0));
+            std::println("---");
+            #endif
+
+            delete[] Rv1;
+            delete[] Rv2;
+
+            return {K0, R0};
+        }
+
+
+        /**
+         * @brief Loads a tuning decision.
+         * The decision cache is a text file with a fingerprint and a kernel name per line.
+         *
+         * @param St0 String [St].
+         * @param N0 Fingerprint.
+         * @return std::tuple<kernel_t, bool> Kernel [K], found.
+         */
+        [[nodiscard]] std::tuple<kernel_t, bool> Ldt_StN_KB(const std::string& St0, const std::uint64_t& N0) {
+            std::FILE* F0 = std::fopen(St0.c_str(), "r");
+
+            if(F0 == nullptr)
+                return {kernel_t::split, false};
+
+            std::uint64_t N1;
+            char Cv0[32];
+
+            while(std::fscanf(F0, "%" SCNx64 " %31s", &N1, Cv0) == 2) {
+                if(N1 != N0)
+                    continue;
+
+                for(std::uint32_t N2 = 0; N2 < std::size(kernel_names); ++N2)
+                    if(kernel_names[N2] == Cv0) {
+                        std::fclose(F0);
+                        return {static_cast<kernel_t>(N2), true};
+                    }
+            }
+
+            std::fclose(F0);
+
+            return {kernel_t::split, false};
+        }
+
+
+        /**
+         * @brief Stores a tuning decision, appending it to the decision cache.
+         *
+         * @param St0 String [St].
+         * @param N0 Fingerprint.
+         * @param K0 Kernel [K].
+         * @return bool Boolean [B], success.
+         */
+        [[nodiscard]] bool Stt_StNK_B(const std::string& St0, const std::uint64_t& N0, const kernel_t& K0) {
+            std::FILE* F0 = std::fopen(St0.c_str(), "a");
+
+            if(F0 == nullptr)
+                return false;
+
+            const bool B0 = std::fprintf(F0, "%016" PRIx64 " %s\n", N0, Nm_K_St(K0).data()) > 0;
+
+            return (std::fclose(F0) == 0) && B0;
+        }
+
+
+        /**
+         * @brief Autotunes the product of a (CSC) sparse matrix, unless its decision is cached.
+         * Statistics are only computed when tuning.
+         * The decision is keyed on the structure only, so it survives a numeric refresh of the values.
+         *
+         * @param St0 String [St], decision cache.
+         * @param N0 Natural number [N].
+         * @param Nv0 Natural vector [Nv].
+         * @param Nv1 Natural vector [Nv].
+         * @param Rv0 Real vector [Rv].
+         * @param B0 Boolean [B], symmetric (lower) storage.
+         * @tparam index_t Index type.
+         * @return std::tuple<kernel_t, bool> Kernel [K], loaded from the decision cache.
+         */
+        template<typename index_t>
+        [[nodiscard]] std::tuple<kernel_t, bool> Atn_StNNvNvRvB_KB(const std::string& St0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const bool& B0) {
+            const std::uint64_t N1 = Fp_NNvNvB_N(N0, Nv0, Nv1, B0);
+            const auto [K0, B1] = Ldt_StN_KB(St0, N1);
+
+            if(B1)
+                return {K0, true};
+
+            const auto [K1, R0] = Tun_NNvNvRvBS_KR(N0, Nv0, Nv1, Rv0, B0, Sts_NNvNvB_S(N0, Nv0, Nv1, B0));
+
+            // A failed store only costs a later re-tuning.
+            [[maybe_unused]] const bool B2 = Stt_StNK_B(St0, N1, K1);
+
+            return {K1, false};
+        }
+
+
+        // Instantiations.
+
+        #define NASS_TUNER_INSTANTIATE(index_t) \
+            template statistics_t Sts_NNvNvB_S(const natural_t&, const index_t*, const index_t*, const bool&); \
+            template std::uint64_t Fp_NNvNvB_N(const natural_t&, const index_t*, const index_t*, const bool&); \
+            template std::tuple<kernel_t, real_t> Tun_NNvNvRvBS_KR(const natural_t&, const index_t*, const index_t*, const real_t*, const bool&, const statistics_t&); \
+            template std::tuple<kernel_t, bool> Atn_StNNvNvRvB_KB(const std::string&, const natural_t&, const index_t*, const index_t*, const real_t*, const bool&);
+
+        NASS_TUNER_INSTANTIATE(natural_t)
+        NASS_TUNER_INSTANTIATE(natural32_t)
+
+        #undef NASS_TUNER_INSTANTIATE
+
+    }
+}
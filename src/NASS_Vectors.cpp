@@ -10,9 +10,9 @@
 
 #include <print>
 #include <cmath>
-#include <cstring>
 
 #include "../include/Vectors.hpp"
+#include "../include/Dispatch.hpp"
 
 namespace nass {
     namespace internal {
@@ -23,35 +23,11 @@ namespace nass {
          * @param Rvt0 Real vector [Rv], target [t].
          * @param Rv0 Real vector [Rv].
          * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Cp_RvtRvN_0(real_t* Rvt0, const real_t* Rv0, const natural_t& N0) {
-            #ifdef _NEON
-
-            #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0));
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1));
-            }
-
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
-                Rvt0[N1] = Rv0[N1];
-
-            #else
-            #ifdef _OPENMP
-
-            #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                Rvt0[N1] = Rv0[N1];
-                Rvt0[N1 + 1] = Rv0[N1 + 1];
-            }
-
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
-                Rvt0[N1] = Rv0[N1];
-
-            #else
-            memcpy(Rvt0, Rv0, N0 * sizeof(real_t));
-            #endif
-            #endif
+        template<typename scalar_t>
+        void Cp_RvtRvN_0(scalar_t* Rvt0, const scalar_t* Rv0, const natural_t& N0) {
+            Vct_0_Vt<scalar_t>().Cp_RvtRvN_0(Rvt0, Rv0, N0);
         }
 
 
@@ -61,48 +37,12 @@ namespace nass {
          * @param Rv0 Real vector [Rv].
          * @param Rv1 Real vector [Rv].
          * @param N0 Natural number [N].
-         * @return real_t Real number [R].
+         * @return scalar_t Real number [R].
+         * @tparam scalar_t Scalar type.
          */
-        real_t Dt_RvRvN_R(const real_t* Rv0, const real_t* Rv1, const natural_t& N0) {
-            #ifdef _NEON
-            
-            reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
-            
-            #pragma omp parallel for reduction(Rd_Rs: Rs0, Rs1)
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs00 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs01 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
-
-                const reals_t Rs10 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs11 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_1);
-
-                Rs0 = Ad_RsRs_Rs(Rs0, Ml_RsRs_Rs(Rs00, Rs10));
-                Rs1 = Ad_RsRs_Rs(Rs1, Ml_RsRs_Rs(Rs01, Rs11));
-            }
-
-            real_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
-
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
-                R0 += Rv0[N1] * Rv1[N1];
-
-            return R0;
-
-            #else
-
-            real_t R0 = 0.0, R1 = 0.0;
-
-            #pragma omp parallel for reduction(+: R0, R1)
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                R0 += Rv0[N1] * Rv1[N1];
-                R1 += Rv0[N1 + 1] * Rv1[N1 + 1];
-            }
-
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
-                R0 += Rv0[N1] * Rv1[N1];
-
-            return R0 + R1;
-
-            #endif
+        template<typename scalar_t>
+        scalar_t Dt_RvRvN_R(const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            return Vct_0_Vt<scalar_t>().Dt_RvRvN_R(Rv0, Rv1, N0);
         }
 
 
@@ -112,48 +52,12 @@ namespace nass {
          * @param Rv0 Real vector [Rv].
          * @param Rv1 Real vector [Rv].
          * @param N0 Natural number [N].
-         * @return real_t Real number [R].
+         * @return scalar_t Real number [R].
+         * @tparam scalar_t Scalar type.
          */
-        real_t NPDt_RvRvN_R(const real_t* Rv0, const real_t* Rv1, const natural_t& N0) {
-            natural_t N1 = 0;
-
-            #ifdef _NEON
-            
-            reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
-
-            for(; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs00 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs01 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
-
-                const reals_t Rs10 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs11 = Ld_Rv_Rs(Rv1 + N1 + MEMORY_OFFSET_1);
-
-                Rs0 = Ad_RsRs_Rs(Rs0, Ml_RsRs_Rs(Rs00, Rs10));
-                Rs1 = Ad_RsRs_Rs(Rs1, Ml_RsRs_Rs(Rs01, Rs11));
-            }
-
-            real_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
-
-            for(; N1 < N0; ++N1)
-                R0 += Rv0[N1] * Rv1[N1];
-
-            return R0;
-
-            #else
-
-            real_t R0 = 0.0, R1 = 0.0;
-
-            for(; N1 < N0 - 1; N1 += 2) {
-                R0 += Rv0[N1] * Rv1[N1];
-                R1 += Rv0[N1 + 1] * Rv1[N1 + 1];
-            }
-
-            for(; N1 < N0; ++N1)
-                R0 += Rv0[N1] * Rv1[N1];
-
-            return R0 + R1;
-
-            #endif
+        template<typename scalar_t>
+        scalar_t NPDt_RvRvN_R(const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            return Vct_0_Vt<scalar_t>().NPDt_RvRvN_R(Rv0, Rv1, N0);
         }
 
 
@@ -162,53 +66,12 @@ namespace nass {
          * 
          * @param Rv0 Real vector [Rv].
          * @param N0 Natural number [N].
-         * @return real_t 
+         * @return scalar_t 
+         * @tparam scalar_t Scalar type.
          */
-        real_t Nr_RvN_R(const real_t* Rv0, const natural_t& N0) {
-            #ifdef _NEON
-            
-            reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
-            
-            #pragma omp parallel for reduction(Rd_Rs: Rs0, Rs1)
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs2 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs3 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
-
-                Rs0 = Ad_RsRs_Rs(Rs0, Ml_RsRs_Rs(Rs2, Rs2));
-                Rs1 = Ad_RsRs_Rs(Rs1, Ml_RsRs_Rs(Rs3, Rs3));
-            }
-
-            real_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
-
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1) {
-                const real_t R3 = Rv0[N1];
-
-                R0 += R3 * R3;
-            }
-
-            return std::sqrt(R0);
-
-            #else
-
-            real_t R0 = 0.0, R1 = 0.0;
-
-            #pragma omp parallel for reduction(+: R0, R1)
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                const real_t R3 = Rv0[N1], R4 = Rv0[N1 + 1];
-
-                R0 += R3 * R3;
-                R1 += R4 * R4;
-            }
-
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1) {
-                const real_t R3 = Rv0[N1];
-
-                R0 += R3 * R3;
-            }
-
-            return std::sqrt(R0 + R1);
-
-            #endif
+        template<typename scalar_t>
+        scalar_t Nr_RvN_R(const scalar_t* Rv0, const natural_t& N0) {
+            return Vct_0_Vt<scalar_t>().Nr_RvN_R(Rv0, N0);
         }
 
 
@@ -217,38 +80,11 @@ namespace nass {
          * 
          * @param Rvt0 Real vector [Rv], target [t].
          * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Nrz_RvtN_0(real_t* Rvt0, const natural_t& N0) {
-            const real_t R0 = Nr_RvN_R(Rvt0, N0);
-
-            #ifdef _NEON
-            
-            const reals_t Rs0 = Ex_R_Rs(R0);
-            
-            #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs1 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs2 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1);
-
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Dv_RsRs_Rs(Rs1, Rs0));
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Dv_RsRs_Rs(Rs2, Rs0));
-            }
-
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
-                Rvt0[N1] /= R0;
-
-            #else
-
-            #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                Rvt0[N1] /= R0;
-                Rvt0[N1 + 1] /= R0;
-            }
-
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
-                Rvt0[N1] /= R0;
-
-            #endif
+        template<typename scalar_t>
+        void Nrz_RvtN_0(scalar_t* Rvt0, const natural_t& N0) {
+            Vct_0_Vt<scalar_t>().Nrz_RvtN_0(Rvt0, N0);
         }
 
 
@@ -257,51 +93,12 @@ namespace nass {
          * 
          * @param Rv0 Real vector [Rv].
          * @param N0 Natural number [N].
-         * @return real_t 
+         * @return scalar_t 
+         * @tparam scalar_t Scalar type.
          */
-        real_t NPNr_RvN_R(const real_t* Rv0, const natural_t& N0) {
-            #ifdef _NEON
-            
-            reals_t Rs0 = Ex_R_Rs(0.0), Rs1 = Ex_R_Rs(0.0);
-            
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs2 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs3 = Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1);
-
-                Rs0 = Ad_RsRs_Rs(Rs0, Ml_RsRs_Rs(Rs2, Rs2));
-                Rs1 = Ad_RsRs_Rs(Rs1, Ml_RsRs_Rs(Rs3, Rs3));
-            }
-
-            real_t R0 = Rd_Rs_R(Rs0) + Rd_Rs_R(Rs1);
-
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1) {
-                const real_t R3 = Rv0[N1];
-
-                R0 += R3 * R3;
-            }
-
-            return std::sqrt(R0);
-
-            #else
-
-            real_t R0 = 0.0, R1 = 0.0;
-
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                const real_t R3 = Rv0[N1], R4 = Rv0[N1 + 1];
-
-                R0 += R3 * R3;
-                R1 += R4 * R4;
-            }
-
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1) {
-                const real_t R3 = Rv0[N1];
-
-                R0 += R3 * R3;
-            }
-
-            return std::sqrt(R0 + R1);
-
-            #endif
+        template<typename scalar_t>
+        scalar_t NPNr_RvN_R(const scalar_t* Rv0, const natural_t& N0) {
+            return Vct_0_Vt<scalar_t>().NPNr_RvN_R(Rv0, N0);
         }
 
 
@@ -310,83 +107,119 @@ namespace nass {
          * 
          * @param Rvt0 Real vector [Rv], target [t].
          * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void NPNrz_RvtN_0(real_t* Rvt0, const natural_t& N0) {
-            const real_t R0 = Nr_RvN_R(Rvt0, N0);
-
-            #ifdef _NEON
-            
-            const reals_t Rs0 = Ex_R_Rs(R0);
-            
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs1 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs2 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1);
-
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Dv_RsRs_Rs(Rs1, Rs0));
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Dv_RsRs_Rs(Rs2, Rs0));
-            }
-
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1)
-                Rvt0[N1] /= R0;
-
-            #else
-
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                Rvt0[N1] /= R0;
-                Rvt0[N1 + 1] /= R0;
-            }
+        template<typename scalar_t>
+        void NPNrz_RvtN_0(scalar_t* Rvt0, const natural_t& N0) {
+            Vct_0_Vt<scalar_t>().NPNrz_RvtN_0(Rvt0, N0);
+        }
 
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1)
-                Rvt0[N1] /= R0;
 
-            #endif
+        /**
+         * @brief Projection onto a real_t*.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t].
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Prj_RvtRvRvN_0(scalar_t* Rvt0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            Vct_0_Vt<scalar_t>().Prj_RvtRvRvN_R(Rvt0, Rv0, Rv1, N0);
         }
 
 
         /**
-         * @brief Projection onto a real_t*.
+         * @brief Projection onto a real_t*, returning its coefficient.
          * 
          * @param Rvt0 Real vector [Rv], target [t].
          * @param Rv0 Real vector [Rv].
          * @param Rv1 Real vector [Rv].
          * @param N0 Natural number [N].
+         * @return scalar_t Real number [R].
+         * @tparam scalar_t Scalar type.
          */
-        void Prj_RvtRvRvN_0(real_t* Rvt0, const real_t* Rv0, const real_t* Rv1, const natural_t& N0) {
-            const real_t R0 = Dt_RvRvN_R(Rv0, Rv1, N0);
-
-            #ifdef _NEON
-            
-            const reals_t Rs0 = Ex_R_Rs(R0);
-            
-            #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0 - LOOP_OFFSET + 1; N1 += LOOP_OFFSET) {
-                const reals_t Rs1 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_0);
-                const reals_t Rs2 = Ld_Rv_Rs(Rvt0 + N1 + MEMORY_OFFSET_1);
-
-                const reals_t Rs3 = Ml_RsRs_Rs(Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_0), Rs0);
-                const reals_t Rs4 = Ml_RsRs_Rs(Ld_Rv_Rs(Rv0 + N1 + MEMORY_OFFSET_1), Rs0);
-
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_0, Sb_RsRs_Rs(Rs1, Rs3));
-                St_RvtRs_0(Rvt0 + N1 + MEMORY_OFFSET_1, Sb_RsRs_Rs(Rs2, Rs4));
-            }
+        template<typename scalar_t>
+        scalar_t Prj_RvtRvRvN_R(scalar_t* Rvt0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0) {
+            return Vct_0_Vt<scalar_t>().Prj_RvtRvRvN_R(Rvt0, Rv0, Rv1, N0);
+        }
 
-            for(natural_t N1 = N0 - (N0 % LOOP_OFFSET); N1 < N0; ++N1) {
-                Rvt0[N1] -= R0 * Rv0[N1];
-            }
 
-            #else
+        /**
+         * @brief Dot products of a real_t* with N2 columns of a basis stored in N3 rotating columns, Rvt0 = Q^T * Rv0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], overwritten. Size: N2.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv].
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Dtb_RvtRmRvNNNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            Vct_0_Vt<scalar_t>().Dtb_RvtRmRvNNNN_0(Rvt0, Rm0, Rv0, N0, N1, N2, N3);
+        }
 
-            #pragma omp parallel for
-            for(natural_t N1 = 0; N1 < N0 - 1; N1 += 2) {
-                Rvt0[N1] -= R0 * Rv0[N1];
-                Rvt0[N1 + 1] -= R0 * Rv0[N1 + 1];
-            }
 
-            for(natural_t N1 = N0 - (N0 % 2); N1 < N0; ++N1) {
-                Rvt0[N1] -= R0 * Rv0[N1];
-            }
+        /**
+         * @brief Subtracts a combination of N2 columns of a basis stored in N3 rotating columns from a real_t*, Rvt0 -= Q * Rv0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], not a column of the basis.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv], coefficients. Size: N2.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Prb_RvtRmRvNNNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            Vct_0_Vt<scalar_t>().Prb_RvtRmRvNNNN_0(Rvt0, Rm0, Rv0, N0, N1, N2, N3);
+        }
+
 
-            #endif
+        /**
+         * @brief Dot products of two real_t* with N2 columns of a basis stored in N3 rotating columns, and with the first real_t*, in a single reduction.
+         * Rvt0 = [Q^T * Rv0, Q^T * Rv1, Rv0^T * Rv0, Rv0^T * Rv1].
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], overwritten. Size: 2 * N2 + 2.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv].
+         * @param Rv1 Real vector [Rv], may alias Rv0.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Dtl_RvtRmRvRvNNNN_0(scalar_t* Rvt0, const scalar_t* Rm0, const scalar_t* Rv0, const scalar_t* Rv1, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3) {
+            Vct_0_Vt<scalar_t>().Dtl_RvtRmRvRvNNNN_0(Rvt0, Rm0, Rv0, Rv1, N0, N1, N2, N3);
+        }
+
+
+        /**
+         * @brief Lagged update of two real_t*, Rvt0 = (Rvt0 - Q * s) / R0 and, when given, Rvt1 = (Rvt1 - Q * z - R1 * Rvt0) / R0, s and z being the halves of Rv0.
+         * 
+         * @param Rvt0 Real vector [Rv], target [t], not a column of the basis.
+         * @param Rvt1 Real vector [Rv], target [t], not a column of the basis, possibly nullptr.
+         * @param Rm0 Real matrix [Rm], basis. Size: N0 x N3.
+         * @param Rv0 Real vector [Rv], coefficients. Size: 2 * N2.
+         * @param N0 Natural number [N].
+         * @param N1 Natural number [N], first column, rotated.
+         * @param N2 Natural number [N], columns.
+         * @param N3 Natural number [N], rotating columns.
+         * @param R0 Real number [R], norm.
+         * @param R1 Real number [R], projection on the updated Rvt0.
+         * @tparam scalar_t Scalar type.
+         */
+        template<typename scalar_t>
+        void Prl_RvtRvtRmRvNNNNRR_0(scalar_t* Rvt0, scalar_t* Rvt1, const scalar_t* Rm0, const scalar_t* Rv0, const natural_t& N0, const natural_t& N1, const natural_t& N2, const natural_t& N3, const scalar_t& R0, const scalar_t& R1) {
+            Vct_0_Vt<scalar_t>().Prl_RvtRvtRmRvNNNNRR_0(Rvt0, Rvt1, Rm0, Rv0, N0, N1, N2, N3, R0, R1);
         }
 
 
@@ -395,12 +228,14 @@ namespace nass {
          * 
          * @param Rrv0 Real row vector [Rrv].
          * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Pr_RrvN_0(const real_t* Rrv0, const natural_t& N0) {
+        template<typename scalar_t>
+        void Pr_RrvN_0(const scalar_t* Rrv0, const natural_t& N0) {
             std::println("--- Row vector.");
 
             for(natural_t N1 = 0; N1 < N0; ++N1) {
-                Pr_R_0(Rrv0[N1]);
+                Pr_R_0(static_cast<real_t>(Rrv0[N1]));
             }
 
             std::println("\n---");
@@ -412,16 +247,43 @@ namespace nass {
          * 
          * @param Rcv0 Real column vector [Rcv].
          * @param N0 Natural number [N].
+         * @tparam scalar_t Scalar type.
          */
-        void Pr_RcvN_0(const real_t* Rcv0, const natural_t& N0) {
+        template<typename scalar_t>
+        void Pr_RcvN_0(const scalar_t* Rcv0, const natural_t& N0) {
             std::println("--- Column vector.");
 
             for(natural_t N1 = 0; N1 < N0; ++N1) {
-                Pn_R_0(Rcv0[N1]);
+                Pn_R_0(static_cast<real_t>(Rcv0[N1]));
             }
 
             std::println("---");
         }
 
+
+        // Instantiations.
+
+        #define NASS_VECTORS_INSTANTIATE(scalar_t) \
+            template void Cp_RvtRvN_0(scalar_t*, const scalar_t*, const natural_t&); \
+            template scalar_t Dt_RvRvN_R(const scalar_t*, const scalar_t*, const natural_t&); \
+            template scalar_t NPDt_RvRvN_R(const scalar_t*, const scalar_t*, const natural_t&); \
+            template scalar_t Nr_RvN_R(const scalar_t*, const natural_t&); \
+            template void Nrz_RvtN_0(scalar_t*, const natural_t&); \
+            template scalar_t NPNr_RvN_R(const scalar_t*, const natural_t&); \
+            template void NPNrz_RvtN_0(scalar_t*, const natural_t&); \
+            template void Prj_RvtRvRvN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&); \
+            template scalar_t Prj_RvtRvRvN_R(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&); \
+            template void Dtb_RvtRmRvNNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&); \
+            template void Prb_RvtRmRvNNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&); \
+            template void Dtl_RvtRmRvRvNNNN_0(scalar_t*, const scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&); \
+            template void Prl_RvtRvtRmRvNNNNRR_0(scalar_t*, scalar_t*, const scalar_t*, const scalar_t*, const natural_t&, const natural_t&, const natural_t&, const natural_t&, const scalar_t&, const scalar_t&); \
+            template void Pr_RrvN_0(const scalar_t*, const natural_t&); \
+            template void Pr_RcvN_0(const scalar_t*, const natural_t&);
+
+        NASS_VECTORS_INSTANTIATE(double)
+        NASS_VECTORS_INSTANTIATE(float)
+
+        #undef NASS_VECTORS_INSTANTIATE
+
     }
 }
\ No newline at end of file
@@ -13,6 +13,9 @@
 
 #include <cstdlib>
 #include <ctime>
+#include <algorithm>
+#include <limits>
+#include <span>
 #include <print>
 
 #include <cmath>
@@ -21,8 +24,14 @@
 #include <chrono>
 using namespace std::chrono;
 
+#include <filesystem>
+
 #include "../include/Sparse.hpp"
+#include "../include/Cache.hpp"
 #include "../include/Solver.hpp"
+#include "../include/Tuner.hpp"
+#include "../include/Numa.hpp"
+#include "../include/Dispatch.hpp"
 using namespace nass;
 
 #endif
\ No newline at end of file
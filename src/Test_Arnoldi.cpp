@@ -0,0 +1,170 @@
+/**
+ * @file Test_Arnoldi.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Truncated Arnoldi benchmark, reference and lagged (low-synchronization) orthogonalization.
+ * @date 2024-12-22
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./Test.hpp"
+
+/**
+ * @brief Loss of orthogonality of a truncated basis, worst inner product within the truncation and worst squared norm deviation.
+ *
+ * @param Rm0 Real matrix [Rm], basis.
+ * @param N0 Natural number [N].
+ * @param N1 Natural number [N], columns.
+ * @param N2 Natural number [N], truncation.
+ * @return std::array<real_t, 2> Real numbers [R].
+ */
+std::array<real_t, 2> Lor_RmNNN_RR(const real_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+    real_t R0 = 0.0, R1 = 0.0;
+
+    for(natural_t N3 = 0; N3 < N1; ++N3) {
+        R1 = std::max(R1, std::abs(internal::Dt_RvRvN_R(Rm0 + N3 * N0, Rm0 + N3 * N0, N0) - 1.0));
+
+        for(natural_t N4 = N3 > N2 ? N3 - N2 : 0; N4 < N3; ++N4)
+            R0 = std::max(R0, std::abs(internal::Dt_RvRvN_R(Rm0 + N3 * N0, Rm0 + N4 * N0, N0)));
+    }
+
+    return {R0, R1};
+}
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    if(argc < 2) {
+        std::println("Usage: {} St [String, path] N? [Natural, Krylov subspace dimension] N? [Natural, Arnoldi truncation] N? [Natural, Repetitions] R? [Real, orthogonality tolerance]", argv[0]);
+        return -1;
+    }
+
+    const natural_t N1 = argc > 2 ? std::atoi(argv[2]) : 100;
+    const natural_t N2 = argc > 3 ? std::atoi(argv[3]) : 4;
+    const natural_t N3 = argc > 4 ? std::atoi(argv[4]) : 10;
+    const real_t R4 = argc > 5 ? std::atof(argv[5]) : 1.0E-10;
+
+    if((N1 < 2) || (N2 == 0) || (N2 > N1)) {
+        std::println("Invalid Krylov subspace dimension or Arnoldi truncation.");
+        return -1;
+    }
+
+
+    // TIMED.
+
+
+    // Start.
+    const auto T0 = high_resolution_clock::now();
+
+    // Sparse matrix, expanded storage.
+    const auto [N0, Nv0, Nv1, Rv0] = internal::Spc_St_NNvNvRv(argv[1]);
+
+    // End.
+    const auto T1 = high_resolution_clock::now();
+
+
+    // TIMED.
+
+
+    // (CSR) sparse matrix.
+    const auto [Nv2, Nv3, Rv1] = internal::Tr_NNvNvRv_NvNvRv(N0, Nv0, Nv1, Rv0);
+
+    // First column.
+    real_t* Rv2 = new real_t[N0];
+
+    for(natural_t N4 = 0; N4 < N0; ++N4)
+        Rv2[N4] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+
+    // Bases, reference and lagged, and coefficients.
+    real_t* Rm0 = new real_t[N0 * N1];
+    real_t* Rm1 = new real_t[N0 * N1];
+    real_t* Rv3 = new real_t[N1];
+
+    duration<real_t> D0 = duration<real_t>::max(), D1 = duration<real_t>::max();
+
+    // Global reductions per Arnoldi step, counted on the last run.
+    [[maybe_unused]] real_t R5 = 0.0, R6 = 0.0;
+
+    for(natural_t N4 = 0; N4 < N3; ++N4) {
+        std::fill_n(Rm0, N0 * N1, 0.0);
+        std::fill_n(Rm1, N0 * N1, 0.0);
+
+        // Reference, block CGS2.
+        const auto T2 = high_resolution_clock::now();
+
+        #ifndef NVERBOSE
+        internal::orthogonalization_reductions = 0;
+        #endif
+
+        internal::Cp_RvtRvN_0(Rm0, Rv2, N0);
+        internal::Nrz_RvtN_0(Rm0, N0);
+
+        for(natural_t N5 = 1; N5 < N1; ++N5) {
+            internal::Mlr_RvtNNvNvRvRv_0(Rm0 + N5 * N0, N0, Nv2, Nv3, Rv1, Rm0 + (N5 - 1) * N0);
+            internal::Ort_RmtRvtNNNN_R(Rm0, Rv3, N0, N5, N2, N1);
+        }
+
+        // Lagged, single-reduction DCGS2, the product of every column being taken before its re-orthogonalization.
+        const auto T3 = high_resolution_clock::now();
+
+        #ifndef NVERBOSE
+        R5 = static_cast<real_t>(internal::orthogonalization_reductions) / (N1 - 1);
+        internal::orthogonalization_reductions = 0;
+        #endif
+
+        internal::Cp_RvtRvN_0(Rm1, Rv2, N0);
+        internal::Nrz_RvtN_0(Rm1, N0);
+
+        for(natural_t N5 = 0; N5 < N1; ++N5) {
+            if(N5 + 1 < N1)
+                internal::Mlr_RvtNNvNvRvRv_0(Rm1 + (N5 + 1) * N0, N0, Nv2, Nv3, Rv1, Rm1 + N5 * N0);
+
+            internal::Lso_RmtRvtNNNNB_R(Rm1, Rv3, N0, N5, N2, N1, N5 + 1 < N1);
+        }
+
+        const auto T4 = high_resolution_clock::now();
+
+        #ifndef NVERBOSE
+        R6 = static_cast<real_t>(internal::orthogonalization_reductions) / N1;
+        #endif
+
+        D0 = std::min<duration<real_t>>(D0, T3 - T2);
+        D1 = std::min<duration<real_t>>(D1, T4 - T3);
+    }
+
+    // Loss of orthogonality.
+    const auto [R0, R1] = Lor_RmNNN_RR(Rm0, N0, N1, N2);
+    const auto [R2, R3] = Lor_RmNNN_RR(Rm1, N0, N1, N2);
+
+    // Both bases are checked against the tolerance, and the lagged orthogonalization against the reference one's reductions.
+    #ifndef NVERBOSE
+    const bool B0 = std::max({R0, R1, R2, R3}) <= R4 && R6 < R5;
+    #else
+    const bool B0 = std::max({R0, R1, R2, R3}) <= R4;
+    #endif
+
+    // Output.
+    std::println("--- Arnoldi testing.");
+    std::println("Parameters: {}, {}, {}, {}", N0, Nv2[N0], N1, N2);
+    std::println("Timings:\n\tLoading: {}", duration_cast<milliseconds>(T1 - T0));
+    std::println("\tReference: {:.3e} s\n\tLagged: {:.3e} s\n\tSpeedup: {:.3e}", D0.count(), D1.count(), D0.count() / D1.count());
+    #ifndef NVERBOSE
+    std::println("Reductions, per step:\n\tReference: {:.3e}\n\tLagged: {:.3e}", R5, R6);
+    #endif
+
+    std::println("Orthogonality:\n\tReference: {:.3e}, norm: {:.3e}\n\tLagged: {:.3e}, norm: {:.3e}", R0, R1, R2, R3);
+    std::println("\tTolerance: {:.3e}, passed: {}", R4, B0);
+    std::println("---");
+
+    // Clean-up.
+    delete[] Nv0; delete[] Nv1; delete[] Rv0;
+    delete[] Nv2; delete[] Nv3; delete[] Rv1;
+    delete[] Rv2; delete[] Rv3;
+    delete[] Rm0; delete[] Rm1;
+
+    return B0 ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file Test_Cache.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Binary cache testing: store, load, numeric refresh and rejection of damaged caches.
+ * @date 2024-12-23
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./Test.hpp"
+
+#include <fstream>
+
+/**
+ * @brief Overwrites a byte of a file.
+ *
+ * @param St0 String [St].
+ * @param N0 Natural number [N], offset.
+ * @param C0 Byte.
+ */
+void Pt_StNC_0(const std::string& St0, const natural_t& N0, const char& C0) {
+    std::fstream F0(St0, std::ios::binary | std::ios::in | std::ios::out);
+
+    F0.seekp(static_cast<std::streamoff>(N0));
+    F0.put(C0);
+}
+
+
+/**
+ * @brief Cache testing on a loaded (CSC) sparse matrix.
+ *
+ * @param St0 String [St], binary cache.
+ * @param N0 Natural number [N].
+ * @param Nv0 Natural vector [Nv].
+ * @param Nv1 Natural vector [Nv].
+ * @param Rv0 Real vector [Rv].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @tparam other_t Other index type, rejected by the load.
+ * @return bool Boolean [B], passed.
+ */
+template<typename index_t, typename other_t>
+bool Test(const std::string& St0, const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const bool& B0) {
+    const natural_t N1 = Nv0[N0];
+
+    // Store.
+    const auto T0 = high_resolution_clock::now();
+    const bool B1 = internal::Stb_StNNvNvRvB_B(St0, N0, Nv0, Nv1, Rv0, B0);
+    const auto T1 = high_resolution_clock::now();
+
+    // Load, the same arrays with the stored index type only.
+    const auto [N2, Nv2, Nv3, Rv1, B2] = internal::Ldb_St_NNvNvRvB<index_t>(St0);
+    const auto T2 = high_resolution_clock::now();
+
+    const bool B3 = N2 == N0 && B2 == B0 && std::equal(Nv0, Nv0 + N0 + 1, Nv2) && std::equal(Nv1, Nv1 + N1, Nv3) && std::equal(Rv0, Rv0 + N1, Rv1);
+    const bool B4 = std::get<0>(internal::Ldb_St_NNvNvRvB<other_t>(St0)) == 0;
+
+    if(N2 > 0)
+        internal::Clb_Nv_0(Nv2);
+
+    // Numeric refresh, new values over the stored structure.
+    real_t* Rv2 = new real_t[N1];
+
+    for(natural_t N3 = 0; N3 < N1; ++N3)
+        Rv2[N3] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+
+    const bool B5 = internal::Rfb_StNRv_B(St0, N1, Rv2);
+    const auto [N3, Nv4, Nv5, Rv3, B6] = internal::Ldb_St_NNvNvRvB<index_t>(St0);
+
+    const bool B7 = B5 && N3 == N0 && B6 == B0 && std::equal(Nv0, Nv0 + N0 + 1, Nv4) && std::equal(Nv1, Nv1 + N1, Nv5) && std::equal(Rv2, Rv2 + N1, Rv3);
+
+    if(N3 > 0)
+        internal::Clb_Nv_0(Nv4);
+
+    // Damaged caches, treated as missing: first pointer, past the 128-byte header, then a truncated file.
+    const natural_t N4 = std::filesystem::file_size(St0);
+
+    Pt_StNC_0(St0, 128, 1);
+    const bool B8 = std::get<0>(internal::Ldb_St_NNvNvRvB<index_t>(St0)) == 0;
+    Pt_StNC_0(St0, 128, 0);
+
+    std::filesystem::resize_file(St0, N4 - 1);
+    const bool B9 = std::get<0>(internal::Ldb_St_NNvNvRvB<index_t>(St0)) == 0;
+
+    std::filesystem::remove(St0);
+
+    const bool B10 = B1 && B3 && B4 && B7 && B8 && B9;
+
+    // Output.
+    std::println("--- Cache testing.");
+    std::println("Parameters: {}, {}", N0, N1);
+    std::println("Storage:\n\tSymmetric: {}\n\tIndices: {} bits", B0, 8 * sizeof(index_t));
+    std::println("Results:\n\tStored: {}\n\tLoaded: {}\n\tOther indices, rejected: {}\n\tRefreshed: {}", B1, B3, B4, B7);
+    std::println("\tDamaged pointers, rejected: {}\n\tTruncated, rejected: {}", B8, B9);
+
+    #ifndef NDEBUG
+    std::println("\tChecksum on load: true");
+    #else
+    std::println("\tChecksum on load: false");
+    #endif
+
+    std::println("Timings:\n\tStore: {}\n\tLoad: {}", duration_cast<microseconds>(T1 - T0), duration_cast<microseconds>(T2 - T1));
+    std::println("\tPassed: {}", B10);
+    std::println("---");
+
+    // Clean-up.
+    delete[] Rv2;
+
+    return B10;
+}
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    if(argc < 2) {
+        std::println("Usage: {} St [String, path]", argv[0]);
+        return -1;
+    }
+
+    // Binary cache, out of the matrix directory.
+    const std::string St0 = (std::filesystem::temp_directory_path() / (std::filesystem::path(argv[1]).filename().string() + ".test.nass")).string();
+
+    // Sparse matrix, symmetric (lower) or expanded storage.
+    const bool B0 = internal::Sym_St_B(argv[1]);
+    const auto [N0, N1] = internal::Sz_St_NN(argv[1]);
+
+    // Both index types.
+    const auto [N2, Nv0, Nv1, Rv0] = B0 ? internal::Sps_St_NNvNvRv(argv[1]) : internal::Spc_St_NNvNvRv(argv[1]);
+    bool B1 = Test<natural_t, natural32_t>(St0, N2, Nv0, Nv1, Rv0, B0);
+
+    if(internal::Nrw_NN_B(N0, N1)) {
+        natural32_t* Nv2 = internal::Nrw_NvN_Nv<natural32_t>(Nv0, N2 + 1);
+        natural32_t* Nv3 = internal::Nrw_NvN_Nv<natural32_t>(Nv1, Nv0[N2]);
+
+        B1 = Test<natural32_t, natural_t>(St0, N2, Nv2, Nv3, Rv0, B0) && B1;
+
+        delete[] Nv2; delete[] Nv3;
+    }
+
+    // Clean-up.
+    delete[] Nv0; delete[] Nv1; delete[] Rv0;
+
+    return B1 ? 0 : 1;
+}
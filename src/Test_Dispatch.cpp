@@ -0,0 +1,139 @@
+/**
+ * @file Test_Dispatch.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Vector kernels benchmark, one per instruction set level.
+ * @date 2024-12-21
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./Test.hpp"
+
+/**
+ * @brief Fastest of N1 timed runs of N2 calls, per entry.
+ *
+ * @param F0 Timed call.
+ * @param N0 Natural number [N], entries.
+ * @param N1 Natural number [N], runs.
+ * @param N2 Natural number [N], calls per run.
+ * @return real_t Real number [R], nanoseconds.
+ */
+template<typename call_t>
+real_t Bnc_FNNN_R(const call_t& F0, const natural_t& N0, const natural_t& N1, const natural_t& N2) {
+    duration<real_t> D0 = duration<real_t>::max();
+
+    for(natural_t N3 = 0; N3 < N1; ++N3) {
+        const auto T0 = high_resolution_clock::now();
+
+        for(natural_t N4 = 0; N4 < N2; ++N4)
+            F0();
+
+        D0 = std::min<duration<real_t>>(D0, high_resolution_clock::now() - T0);
+    }
+
+    return D0.count() * 1.0E9 / (N0 * N2);
+}
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    const natural_t N0 = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+    const natural_t N1 = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    if(N0 == 0) {
+        std::println("Usage: {} N? [Natural, Size] N? [Natural, Repetitions]", argv[0]);
+        return -1;
+    }
+
+    // Calls per run, about 2^24 entries.
+    const natural_t N2 = std::max<natural_t>((1 << 24) / N0, 1);
+
+    // Vectors.
+    real_t* Rv0 = new real_t[N0];
+    real_t* Rv1 = new real_t[N0];
+    real_t* Rv2 = new real_t[N0];
+
+    for(natural_t N3 = 0; N3 < N0; ++N3) {
+        Rv0[N3] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+        Rv1[N3] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+    }
+
+    // Block, N3 normalized columns, and its coefficients.
+    const natural_t N3 = 4;
+
+    real_t* Rm0 = new real_t[N0 * N3];
+    real_t* Rv3 = new real_t[N3];
+
+    for(natural_t N4 = 0; N4 < N0 * N3; ++N4)
+        Rm0[N4] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+
+    for(natural_t N4 = 0; N4 < N3; ++N4)
+        internal::Nrz_RvtN_0(Rm0 + N4 * N0, N0);
+
+    // Levels, the reference one being the lowest.
+    const std::vector<internal::isa_t> Iv0 = internal::Lvs_0_Iv();
+    const internal::isa_t I0 = internal::Isa_0_I();
+
+    const internal::vectors_t<real_t>& Vt0 = internal::Vct_I_Vt<real_t>(Iv0.front());
+    const real_t R0 = Vt0.Dt_RvRvN_R(Rv0, Rv1, N0), R1 = Vt0.Nr_RvN_R(Rv0, N0);
+
+    // (SELL-C-σ) chunk products, on whole chunks.
+    const natural_t N5 = N0 - N0 % internal::sell_chunk;
+
+    real_t* Rv4 = new real_t[internal::sell_chunk];
+    real_t* Rv5 = new real_t[internal::sell_chunk];
+
+    Vt0.Dtc_RvtRvRvNN_0(Rv4, Rv0, Rv1, N5, internal::sell_chunk);
+
+    // Output.
+    std::println("--- Dispatch testing.");
+    std::println("Parameters: {}, {}", N0, N1);
+    std::println("Levels:\n\tSupported: {}\n\tSelected: {}", Iv0.size(), internal::Nm_I_St(I0));
+    std::println("Bound:\n\tLevel: {}", internal::Nm_I_St(internal::Vct_0_Vt<real_t>().I0));
+
+    for(const internal::isa_t& I1: Iv0) {
+        const internal::vectors_t<real_t>& Vt1 = internal::Vct_I_Vt<real_t>(I1);
+
+        // Results, relative to the reference level.
+        const real_t R2 = std::abs(Vt1.Dt_RvRvN_R(Rv0, Rv1, N0) - R0) / std::abs(R0);
+        const real_t R3 = std::abs(Vt1.Nr_RvN_R(Rv0, N0) - R1) / R1;
+
+        Vt1.Dtc_RvtRvRvNN_0(Rv5, Rv0, Rv1, N5, internal::sell_chunk);
+
+        for(natural_t N4 = 0; N4 < internal::sell_chunk; ++N4)
+            Rv5[N4] -= Rv4[N4];
+
+        const real_t R10 = internal::Nr_RvN_R(Rv5, internal::sell_chunk) / internal::Nr_RvN_R(Rv4, internal::sell_chunk);
+
+        // Timings, nanoseconds per entry.
+        volatile real_t R4 = 0.0;
+
+        const real_t R5 = Bnc_FNNN_R([&]() { R4 = R4 + Vt1.Dt_RvRvN_R(Rv0, Rv1, N0); }, N0, N1, N2);
+        const real_t R6 = Bnc_FNNN_R([&]() { R4 = R4 + Vt1.Nr_RvN_R(Rv0, N0); }, N0, N1, N2);
+        const real_t R7 = Bnc_FNNN_R([&]() { Vt1.Cp_RvtRvN_0(Rv2, Rv1, N0); }, N0, N1, N2);
+        const real_t R8 = Bnc_FNNN_R([&]() { Vt1.Prj_RvtRvRvN_R(Rv2, Rv0, Rv1, N0); }, N0, N1, N2);
+        const real_t R9 = Bnc_FNNN_R([&]() { Vt1.Nrz_RvtN_0(Rv2, N0); }, N0, N1, N2);
+        const real_t R11 = Bnc_FNNN_R([&]() { Vt1.Axm_RvtRRvN_0(Rv2, R0, Rv1, N0); }, N0, N1, N2);
+        const real_t R12 = Bnc_FNNN_R([&]() { Vt1.Fma_RvtRvRvN_0(Rv2, Rv0, Rv1, N0); }, N0, N1, N2);
+        const real_t R13 = Bnc_FNNN_R([&]() { Vt1.Dtc_RvtRvRvNN_0(Rv5, Rv0, Rv1, N5, internal::sell_chunk); }, N5, N1, N2);
+        const real_t R14 = Bnc_FNNN_R([&]() { Vt1.Dtb_RvtRmRvNNNN_0(Rv3, Rm0, Rv2, N0, 0, N3, N3); Vt1.Prb_RvtRmRvNNNN_0(Rv2, Rm0, Rv3, N0, 0, N3, N3); }, N0 * N3, N1, N2);
+
+        std::println("Level: {}{}", internal::Nm_I_St(I1), I1 == I0 ? " (selected)" : "");
+        std::println("\tError, dot product: {:.3e}\n\tError, norm: {:.3e}\n\tError, chunk product: {:.3e}", R2, R3, R10);
+        std::println("\tDot product: {:.3f} ns\n\tNorm: {:.3f} ns\n\tCopy: {:.3f} ns\n\tProjection: {:.3f} ns\n\tNormalization: {:.3f} ns\n\tBlock projection: {:.3f} ns", R5, R6, R7, R8, R9, R14);
+        std::println("\tRow update: {:.3f} ns\n\tDiagonal update: {:.3f} ns\n\tChunk product: {:.3f} ns", R11, R12, R13);
+    }
+
+    std::println("---");
+
+    // Clean-up.
+    delete[] Rv0; delete[] Rv1; delete[] Rv2;
+    delete[] Rm0; delete[] Rv3;
+    delete[] Rv4; delete[] Rv5;
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file Test_Multivector.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Multivector (CSC) products testing, against as many products by a single vector.
+ * @date 2024-12-22
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./Test.hpp"
+
+/**
+ * @brief Largest difference between a multivector product and the products of its vectors by Mlc_RvtNNvNvRvRv_0, relative to |A| * |x|, in machine epsilons.
+ *
+ * @param Rm0 Real matrix [Rm], product, row-major if B0, by column otherwise. Size: N0 x N2.
+ * @param N0 Natural number [N], rows.
+ * @param N1 Natural number [N], columns.
+ * @param Nv0 Natural vector [Nv].
+ * @param Nv1 Natural vector [Nv].
+ * @param Rv0 Real vector [Rv].
+ * @param Rm1 Real matrix [Rm], vectors, by column. Size: N1 x N2.
+ * @param N2 Natural number [N], vectors.
+ * @param B0 Boolean [B], row-major product.
+ * @return real_t Real number [R].
+ */
+real_t Err_RmNNNvNvRvRmNB_R(const real_t* Rm0, const natural_t& N0, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const real_t* Rm1, const natural_t& N2, const bool& B0) {
+    real_t* Rv1 = new real_t[N0];
+    real_t* Rv2 = new real_t[N0];
+
+    real_t R0 = 0.0;
+
+    for(natural_t N3 = 0; N3 < N2; ++N3) {
+        const real_t* Rv3 = Rm1 + N3 * N1;
+
+        std::fill_n(Rv1, N0, 0.0);
+        std::fill_n(Rv2, N0, 0.0);
+
+        // Reference and its magnitude, |A| * |x|.
+        internal::Mlc_RvtNNvNvRvRv_0(Rv1, N1, Nv0, Nv1, Rv0, Rv3);
+
+        for(natural_t N4 = 0; N4 < N1; ++N4)
+            for(natural_t N5 = Nv0[N4]; N5 < Nv0[N4 + 1]; ++N5)
+                Rv2[Nv1[N5]] += std::abs(Rv0[N5] * Rv3[N4]);
+
+        real_t R1 = 0.0, R2 = 0.0;
+
+        for(natural_t N4 = 0; N4 < N0; ++N4) {
+            R1 = std::max(R1, std::abs((B0 ? Rm0[N4 * N2 + N3] : Rm0[N3 * N0 + N4]) - Rv1[N4]));
+            R2 = std::max(R2, Rv2[N4]);
+        }
+
+        R0 = std::max(R0, R2 > 0.0 ? R1 / R2 / std::numeric_limits<real_t>::epsilon() : R1);
+    }
+
+    delete[] Rv1; delete[] Rv2;
+
+    return R0;
+}
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    if(argc < 2) {
+        std::println("Usage: {} St [String, path] R? [Real, Tolerance, in machine epsilons]", argv[0]);
+        return -1;
+    }
+
+    const real_t R0 = argc > 2 ? std::atof(argv[2]) : 16.0;
+
+    // Sparse matrix, expanded storage, and its splitting among threads.
+    const auto [N0, Nv0, Nv1, Rv0] = internal::Spc_St_NNvNvRv(argv[1]);
+    const auto [N1, Nv2, Nv3] = internal::Spl_NNvNv_NNvNv(N0, Nv0, Nv1);
+
+    // Sketch, few rows.
+    const natural_t N2 = 100, N3 = 2 * (N2 + 1);
+    const auto [Nv4, Nv5, Rv1] = internal::Sec_NNN_NvNvRv<real_t>(N2, N0, std::rand());
+
+    // Vectors, single, below and on the vector widths, and columns, whole, split in tiles and a single partial tile.
+    const std::array<natural_t, 5> Nv6 = {1, 3, 4, 8, 13};
+    const std::array<natural_t, 3> Nv7 = {N0, N0 / 2 + 1, std::min<natural_t>(N0, 7)};
+
+    // Windows of the column splitting, private copies and packed tiles of the tiled product.
+    std::vector<real_t> Rv2;
+
+    real_t R1 = 0.0, R2 = 0.0, R3 = 0.0;
+
+    for(const natural_t& N4: Nv6) {
+
+        // Vectors, by column and row-major.
+        real_t* Rm0 = new real_t[N0 * N4];
+        real_t* Rm1 = new real_t[N0 * N4];
+
+        for(natural_t N5 = 0; N5 < N0 * N4; ++N5)
+            Rm0[N5] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+
+        for(natural_t N5 = 0; N5 < N4; ++N5)
+            for(natural_t N6 = 0; N6 < N0; ++N6)
+                Rm1[N6 * N4 + N5] = Rm0[N5 * N0 + N6];
+
+        // Row-owned parallel product, row-major.
+        real_t* Rm2 = new real_t[N0 * N4]();
+
+        internal::Mlm_RmtNNvNvRvRmNNNvNvRvt_0(Rm2, N0, Nv0, Nv1, Rv0, Rm1, N4, N1, Nv2, Nv3, Rv2);
+        R1 = std::max(R1, Err_RmNNNvNvRvRmNB_R(Rm2, N0, N0, Nv0, Nv1, Rv0, Rm0, N4, true));
+
+        // Column-owned tiled product, on the leading columns of the matrix and on the sketch.
+        for(const natural_t& N5: Nv7) {
+            std::fill_n(Rm2, N0 * N4, 0.0);
+
+            real_t* Rm3 = new real_t[N5 * N4];
+
+            for(natural_t N6 = 0; N6 < N4; ++N6)
+                std::copy_n(Rm0 + N6 * N0, N5, Rm3 + N6 * N5);
+
+            internal::Mlc_RmtNNNvNvRvRmNRvt_0(Rm2, N0, N5, Nv0, Nv1, Rv0, Rm3, N4, Rv2);
+            R2 = std::max(R2, Err_RmNNNvNvRvRmNB_R(Rm2, N0, N5, Nv0, Nv1, Rv0, Rm3, N4, false));
+
+            delete[] Rm3;
+        }
+
+        real_t* Rm4 = new real_t[N3 * N4]();
+
+        internal::Mlc_RmtNNNvNvRvRmNRvt_0(Rm4, N3, N0, Nv4, Nv5, Rv1, Rm0, N4, Rv2);
+        R3 = std::max(R3, Err_RmNNNvNvRvRmNB_R(Rm4, N3, N0, Nv4, Nv5, Rv1, Rm0, N4, false));
+
+        delete[] Rm0; delete[] Rm1; delete[] Rm2; delete[] Rm4;
+    }
+
+    // All the products are checked against the tolerance.
+    const bool B0 = std::max({R1, R2, R3}) <= R0;
+
+    // Output.
+    std::println("--- Multivector testing.");
+    std::println("Parameters: {}, {}, {}", N0, Nv0[N0], N3);
+    std::println("Vectors: {}\nColumns: {}", Nv6, Nv7);
+    std::println("Splitting:\n\tThreads: {}\n\tBy: {}", N1, Nv3[2 * N1] == 1 ? "columns" : "rows");
+    std::println("Error, epsilons:\n\tRow-owned: {:.3e}\n\tTiled: {:.3e}\n\tTiled, sketch: {:.3e}", R1, R2, R3);
+    std::println("\tTolerance: {:.3e}, passed: {}", R0, B0);
+    std::println("---");
+
+    // Clean-up.
+    delete[] Nv0; delete[] Nv1; delete[] Rv0;
+    delete[] Nv2; delete[] Nv3;
+    delete[] Nv4; delete[] Nv5; delete[] Rv1;
+
+    return B0 ? 0 : 1;
+}
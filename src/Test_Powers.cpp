@@ -0,0 +1,142 @@
+/**
+ * @file Test_Powers.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix powers kernel benchmark.
+ * @date 2024-12-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./Test.hpp"
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    if(argc < 2) {
+        std::println("Usage: {} St [String, path] N? [Natural, Repetitions]", argv[0]);
+        return -1;
+    }
+
+    const natural_t N1 = argc > 2 ? std::atoi(argv[2]) : 10;
+    const natural_t N2 = internal::powers_steps;
+
+
+    // TIMED.
+
+
+    // Start.
+    const auto T0 = high_resolution_clock::now();
+
+    // Sparse matrix, expanded storage.
+    const auto [N0, Nv0, Nv1, Rv0] = internal::Spc_St_NNvNvRv(argv[1]);
+
+    // End.
+    const auto T1 = high_resolution_clock::now();
+
+
+    // TIMED.
+
+
+    #ifdef RCM_ORDERING
+
+    // Reverse Cuthill-McKee ordering.
+    natural_t* Nv2 = internal::Rcm_NNvNv_Nv(N0, Nv0, Nv1);
+    const auto [Nv3, Nv4, Rv1] = internal::Prm_NNvNvRvNvB_NvNvRv(N0, Nv0, Nv1, Rv0, Nv2, false);
+
+    delete[] Nv0; delete[] Nv1; delete[] Rv0;
+    delete[] Nv2;
+
+    #else
+
+    const auto [Nv3, Nv4, Rv1] = std::tuple<natural_t*, natural_t*, real_t*>{Nv0, Nv1, Rv0};
+
+    #endif
+
+    // (CSR) sparse matrix and its partition.
+    const auto [Nv5, Nv6, Rv2] = internal::Tr_NNvNvRv_NvNvRv(N0, Nv3, Nv4, Rv1);
+    const auto [N3, Nv7] = internal::Pwp_NNvNv_NNv(N0, Nv5, Nv6);
+
+    // Redundancy, rows computed per row owned, and scaling.
+    const real_t R1 = internal::Pwr_NNNv_R(N0, N3, Nv7);
+    const real_t R2 = internal::Pws_NNvRv_R(N0, Nv5, Rv2);
+
+    // Vector.
+    real_t* Rv3 = new real_t[N0];
+
+    for(natural_t N5 = 0; N5 < N0; ++N5)
+        Rv3[N5] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+
+    // Shifts, spread over the scaling.
+    real_t* Rv4 = new real_t[N2];
+
+    for(natural_t N5 = 0; N5 < N2; ++N5)
+        Rv4[N5] = R2 * (N5 + 1) / (N2 + 1);
+
+    // Scaled Newton basis, sequential products and matrix powers kernel.
+    real_t* Rm0 = new real_t[N0 * N2];
+    real_t* Rm1 = new real_t[N0 * N2];
+
+    duration<real_t> D0 = duration<real_t>::max(), D1 = duration<real_t>::max();
+
+    for(natural_t N5 = 0; N5 < N1; ++N5) {
+        std::fill_n(Rm0, N0 * N2, 0.0);
+
+        const auto T2 = high_resolution_clock::now();
+
+        for(natural_t N6 = 0; N6 < N2; ++N6) {
+            const real_t* Rv5 = N6 == 0 ? Rv3 : Rm0 + (N6 - 1) * N0;
+
+            internal::Mlr_RvtNNvNvRvRv_0(Rm0 + N6 * N0, N0, Nv5, Nv6, Rv2, Rv5);
+
+            for(natural_t N7 = 0; N7 < N0; ++N7)
+                Rm0[N6 * N0 + N7] = (Rm0[N6 * N0 + N7] - Rv4[N6] * Rv5[N7]) / R2;
+        }
+
+        const auto T3 = high_resolution_clock::now();
+
+        internal::Mpk_RmtNNvNvRvRvRvNNNvR_0(Rm1, N0, Nv5, Nv6, Rv2, Rv3, Rv4, N2, N3, Nv7, R2);
+
+        const auto T4 = high_resolution_clock::now();
+
+        D0 = std::min<duration<real_t>>(D0, T3 - T2);
+        D1 = std::min<duration<real_t>>(D1, T4 - T3);
+    }
+
+    // Relative error, worst power.
+    real_t R0 = 0.0;
+
+    for(natural_t N5 = 0; N5 < N2; ++N5) {
+        for(natural_t N6 = 0; N6 < N0; ++N6)
+            Rm1[N5 * N0 + N6] -= Rm0[N5 * N0 + N6];
+
+        R0 = std::max(R0, internal::Nr_RvN_R(Rm1 + N5 * N0, N0) / internal::Nr_RvN_R(Rm0 + N5 * N0, N0));
+    }
+
+    // Output.
+    std::println("--- Matrix powers testing.");
+    std::println("Parameters: {}, {}, {}", N0, Nv3[N0], N2);
+    std::println("Results:\n\tError, relative: {:.3e}", R0);
+    std::println("Timings:\n\tLoading: {}", duration_cast<milliseconds>(T1 - T0));
+    std::println("\tProducts: {:.3e} s\n\tMatrix powers: {:.3e} s\n\tSpeedup: {:.3e}", D0.count(), D1.count(), D0.count() / D1.count());
+    std::println("Partition:\n\tBlocks: {}\n\tRedundancy: {:.3e}, {}", N3, R1, R1 > internal::powers_redundancy || D1 >= D0 ? "plain operator" : "matrix powers");
+    std::println("\tScaling: {:.3e}", R2);
+
+    #ifdef RCM_ORDERING
+    std::println("\tReordering: RCM");
+    #endif
+
+    std::println("---");
+
+    // Clean-up.
+    delete[] Nv3; delete[] Nv4; delete[] Rv1;
+    delete[] Nv5; delete[] Nv6; delete[] Rv2;
+    delete[] Nv7;
+    delete[] Rv3; delete[] Rv4;
+    delete[] Rm0; delete[] Rm1;
+
+    return 0;
+}
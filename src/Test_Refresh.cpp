@@ -0,0 +1,324 @@
+/**
+ * @file Test_Refresh.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Numeric refresh testing, every derived layout against its fresh build.
+ * @date 2024-12-23
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./Test.hpp"
+
+/**
+ * @brief Largest difference between two value_t*, relative to the largest magnitude of the reference, in machine epsilons of value_t.
+ *
+ * @param Rv0 Real vector [Rv].
+ * @param Rv1 Real vector [Rv], reference.
+ * @param N0 Natural number [N].
+ * @tparam value_t Value type.
+ * @return real_t Real number [R].
+ */
+template<typename value_t>
+real_t Df_RvRvN_R(const value_t* Rv0, const value_t* Rv1, const natural_t& N0) {
+    real_t R0 = 0.0, R1 = 0.0;
+
+    for(natural_t N1 = 0; N1 < N0; ++N1) {
+        R0 = std::max<real_t>(R0, std::abs(static_cast<real_t>(Rv0[N1]) - static_cast<real_t>(Rv1[N1])));
+        R1 = std::max<real_t>(R1, std::abs(static_cast<real_t>(Rv1[N1])));
+    }
+
+    return R1 > 0.0 ? R0 / R1 / std::numeric_limits<value_t>::epsilon() : R0;
+}
+
+
+/**
+ * @brief Builds the values of a layout from a (CSC) sparse matrix, as the tests do, independently of its pattern.
+ *
+ * @param N0 Natural number [N].
+ * @param Nv0 Natural vector [Nv].
+ * @param Nv1 Natural vector [Nv].
+ * @param Rv0 Real vector [Rv].
+ * @param L0 Layout [L].
+ * @param N1 Natural number [N], block size for layout_t::bcsr.
+ * @param Nv2 Natural vector [Nv], permutation for layout_t::permuted.
+ * @param B0 Boolean [B], symmetric (lower) storage for layout_t::permuted.
+ * @tparam index_t Index type.
+ * @return std::tuple<natural_t, real_t*> Slots and values.
+ */
+template<typename index_t>
+std::tuple<natural_t, real_t*> Lyt_NNvNvRvLNNvB_NRv(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const internal::layout_t& L0, const natural_t& N1, const natural_t* Nv2, const bool& B0) {
+    switch(L0) {
+        case internal::layout_t::permuted: {
+            const auto [Nv3, Nv4, Rv1] = internal::Prm_NNvNvRvNvB_NvNvRv(N0, Nv0, Nv1, Rv0, Nv2, B0);
+            delete[] Nv3; delete[] Nv4;
+            return {Nv0[N0], Rv1};
+        }
+        case internal::layout_t::csr: {
+            const auto [Nv3, Nv4, Rv1] = internal::Tr_NNvNvRv_NvNvRv(N0, Nv0, Nv1, Rv0);
+            delete[] Nv3; delete[] Nv4;
+            return {Nv0[N0], Rv1};
+        }
+        case internal::layout_t::sell: {
+            const auto [Nv3, Nv4, Nv5, Rv1] = internal::Sel_NNvNvRv_NvNvNvRv(N0, Nv0, Nv1, Rv0);
+            const natural_t N2 = Nv4[(N0 + internal::sell_chunk - 1) / internal::sell_chunk];
+            delete[] Nv3; delete[] Nv4; delete[] Nv5;
+            return {N2, Rv1};
+        }
+        case internal::layout_t::bcsr: {
+            const auto [Nv3, Nv4, Rv1] = internal::Bcr_NNNvNvRv_NvNvRv(N0, N1, Nv0, Nv1, Rv0);
+            const natural_t N2 = Nv3[N0 / N1] * N1 * N1;
+            delete[] Nv3; delete[] Nv4;
+            return {N2, Rv1};
+        }
+        case internal::layout_t::dia: {
+            const auto [N2, Iv0, Rv1] = internal::Dia_NNvNvRv_NIvRv(N0, Nv0, Nv1, Rv0);
+            delete[] Iv0;
+            return {N2 * N0, Rv1};
+        }
+        default: {
+            real_t* Rv1 = new real_t[Nv0[N0]];
+            std::copy(Rv0, Rv0 + Nv0[N0], Rv1);
+            return {Nv0[N0], Rv1};
+        }
+    }
+}
+
+
+/**
+ * @brief Writes (COO) entries as a (.mtx) file.
+ *
+ * @param St0 String [St].
+ * @param N0 Natural number [N].
+ * @param N1 Natural number [N], entries.
+ * @param Nv0 Natural vector [Nv], rows.
+ * @param Nv1 Natural vector [Nv], columns.
+ * @param Rv0 Real vector [Rv].
+ * @param B0 Boolean [B], symmetric entries.
+ * @return bool Boolean [B], success.
+ */
+bool Wr_StNNNvNvRvB_B(const std::string& St0, const natural_t& N0, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const bool& B0) {
+    std::FILE* F0 = std::fopen(St0.c_str(), "w");
+
+    if(F0 == nullptr)
+        return false;
+
+    std::println(F0, "%%MatrixMarket matrix coordinate real {}", B0 ? "symmetric" : "general");
+    std::println(F0, "{} {} {}", N0, N0, N1);
+
+    for(natural_t N2 = 0; N2 < N1; ++N2)
+        std::println(F0, "{} {} {}", Nv0[N2] + 1, Nv1[N2] + 1, Rv0[N2]);
+
+    return std::fclose(F0) == 0;
+}
+
+
+/**
+ * @brief Refresh testing on a storage: every layout is built from the loaded matrix, refreshed from new (COO) values and checked against its build from the refreshed file.
+ *
+ * @param St0 String [St], matrix file.
+ * @param St1 String [St], refreshed file, same entries.
+ * @param N0 Natural number [N], (COO) entries.
+ * @param Nv0 Natural vector [Nv], (COO) rows.
+ * @param Nv1 Natural vector [Nv], (COO) columns.
+ * @param Rv0 Real vector [Rv], (COO) refreshed values.
+ * @param B0 Boolean [B], symmetric entries.
+ * @param B1 Boolean [B], symmetric (lower) storage.
+ * @param R0 Real number [R], tolerance, in machine epsilons.
+ * @tparam index_t Index type.
+ * @return bool Boolean [B], passed.
+ */
+template<typename index_t>
+bool Test(const std::string& St0, const std::string& St1, const natural_t& N0, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv0, const bool& B0, const bool& B1, const real_t& R0) {
+
+    // Sparse matrix, as loaded and as loaded from the refreshed file.
+    const auto [N1, Nv2, Nv3, Rv1] = B1 ? internal::Sps_St_NNvNvRv<index_t>(St0) : internal::Spc_St_NNvNvRv<index_t>(St0);
+    const auto [N2, Nv4, Nv5, Rv2] = B1 ? internal::Sps_St_NNvNvRv<index_t>(St1) : internal::Spc_St_NNvNvRv<index_t>(St1);
+
+    const natural_t N3 = Nv2[N1];
+
+    // Same structure, the refresh keeps it.
+    const bool B2 = N2 == N1 && std::equal(Nv2, Nv2 + N1 + 1, Nv4) && std::equal(Nv3, Nv3 + N3, Nv5);
+
+    // Permutation and permuted matrix, layouts are also derived from it.
+    natural_t* Nv6 = internal::Rcm_NNvNv_Nv(N1, Nv2, Nv3);
+    const auto [Nv7, Nv8, Rv3] = internal::Prm_NNvNvRvNvB_NvNvRv(N1, Nv2, Nv3, Rv1, Nv6, B1);
+
+    const internal::derived_t D0 = internal::Drv_RvNNvNvDLNNvB_D(Rv3, N1, Nv2, Nv3, static_cast<const internal::derived_t*>(nullptr), internal::layout_t::permuted, 1, Nv6, B1);
+
+    // Block size and diagonals, general storage.
+    const natural_t N4 = B1 ? 1 : internal::Blk_NNvNv_N(N1, Nv2, Nv3);
+    const natural_t N5 = N4 > 1 ? N4 : (N1 % internal::block_sizes[0] == 0 ? internal::block_sizes[0] : 1);
+
+    const auto [N6, Iv0, Rv4] = B1 ? std::tuple<natural_t, integer_t*, real_t*>{0, nullptr, nullptr} : internal::Dia_NNvNvRv_NIvRv(N1, Nv2, Nv3, Rv1);
+    const auto [N7, Iv1, Rv5] = B1 ? std::tuple<natural_t, integer_t*, real_t*>{0, nullptr, nullptr} : internal::Dia_NNvNvRv_NIvRv(N1, Nv7, Nv8, Rv3);
+
+    delete[] Iv0; delete[] Rv4;
+    delete[] Iv1; delete[] Rv5;
+
+    // Layouts: name, layout, block size, built from the permuted matrix, narrowed values.
+    // Copies cover the first-touch copy and the solver's single-precision values, (CSR) the matrix powers.
+    std::vector<std::tuple<std::string, internal::layout_t, natural_t, bool, bool>> Vv0 = {
+        {"Copy", internal::layout_t::copy, 1, false, false},
+        {"Copy, narrowed", internal::layout_t::copy, 1, false, true},
+        {"Permuted, narrowed", internal::layout_t::copy, 1, true, true}
+    };
+
+    if(!B1) {
+        Vv0.push_back({"CSR", internal::layout_t::csr, 1, false, false});
+        Vv0.push_back({"SELL-C-σ", internal::layout_t::sell, 1, false, false});
+        Vv0.push_back({"CSR, permuted", internal::layout_t::csr, 1, true, false});
+        Vv0.push_back({"SELL-C-σ, permuted", internal::layout_t::sell, 1, true, false});
+
+        if(N5 > 1)
+            Vv0.push_back({"BCSR", internal::layout_t::bcsr, N5, false, false});
+
+        if(N6 > 0)
+            Vv0.push_back({"DIA", internal::layout_t::dia, 1, false, false});
+
+        if(N7 > 0)
+            Vv0.push_back({"DIA, permuted", internal::layout_t::dia, 1, true, false});
+    }
+
+    // Layouts, built from the matrix or from the permuted one, the pattern of the latter chaining to the matrix.
+    std::vector<internal::derived_t> Dv0{D0};
+
+    for(const auto& [St2, L0, N8, B3, B4]: Vv0) {
+        const index_t* Nv9 = B3 ? Nv7 : Nv2;
+        const index_t* Nv10 = B3 ? Nv8 : Nv3;
+        const internal::derived_t* D1 = B3 ? &D0 : nullptr;
+
+        const auto [N9, Rv6] = Lyt_NNvNvRvLNNvB_NRv(N1, Nv9, Nv10, B3 ? Rv3 : Rv1, L0, N8, static_cast<const natural_t*>(nullptr), false);
+
+        if(B4) {
+            Dv0.push_back(internal::Drv_RvNNvNvDLNNvB_D(internal::Nrw_RvN_Rv<value32_t>(Rv6, N9), N1, Nv9, Nv10, D1, L0, N8, static_cast<const natural_t*>(nullptr), false));
+            delete[] Rv6;
+        } else
+            Dv0.push_back(internal::Drv_RvNNvNvDLNNvB_D(Rv6, N1, Nv9, Nv10, D1, L0, N8, static_cast<const natural_t*>(nullptr), false));
+    }
+
+    // Refresh: the matrix through its pattern, then every layout from the matrix.
+    const auto T0 = high_resolution_clock::now();
+
+    const auto [Nv11, Nv12] = internal::Ptn_NNvNvNNvNvBB_NvNv(N1, Nv2, Nv3, N0, Nv0, Nv1, B0, B1);
+
+    const auto T1 = high_resolution_clock::now();
+
+    internal::Rfs_RvtNNvNvRv_0(Rv1, N3, Nv11, Nv12, Rv0);
+    internal::Rfd_DvRv_0(Dv0, Rv1);
+
+    const auto T2 = high_resolution_clock::now();
+
+    // Fresh builds, from the refreshed file.
+    const auto [Nv13, Nv14, Rv7] = internal::Prm_NNvNvRvNvB_NvNvRv(N2, Nv4, Nv5, Rv2, Nv6, B1);
+
+    std::vector<std::tuple<std::string, natural_t, real_t>> Vv1 = {{"Matrix", N3, Df_RvRvN_R(Rv1, Rv2, N3)}, {"Permuted", N3, Df_RvRvN_R(Rv3, Rv7, N3)}};
+
+    for(natural_t N8 = 0; N8 < Vv0.size(); ++N8) {
+        const auto& [St2, L0, N9, B3, B4] = Vv0[N8];
+        const internal::derived_t& D1 = Dv0[N8 + 1];
+
+        const auto [N10, Rv8] = Lyt_NNvNvRvLNNvB_NRv(N2, B3 ? Nv13 : Nv4, B3 ? Nv14 : Nv5, B3 ? Rv7 : Rv2, L0, N9, static_cast<const natural_t*>(nullptr), false);
+
+        if(N10 != D1.N0)
+            Vv1.push_back({St2, D1.N0, std::numeric_limits<real_t>::infinity()});
+        else if(B4) {
+            value32_t* Rv9 = internal::Nrw_RvN_Rv<value32_t>(Rv8, N10);
+            Vv1.push_back({St2, N10, Df_RvRvN_R(D1.Rv1, Rv9, N10)});
+            delete[] Rv9;
+        } else
+            Vv1.push_back({St2, N10, Df_RvRvN_R(D1.Rv0, Rv8, N10)});
+
+        delete[] Rv8;
+    }
+
+    // Every refreshed array is checked against its fresh build, repeated entries may be summed in another order.
+    bool B5 = B2;
+
+    for(const auto& [St2, N8, R1]: Vv1)
+        B5 = B5 && R1 <= R0;
+
+    // Output.
+    std::println("--- Refresh testing.");
+    std::println("Parameters: {}, {}, {}", N1, N0, N3);
+    std::println("Storage:\n\tSymmetric: {}\n\tIndices: {} bits\n\tStructure, kept: {}", B1, 8 * sizeof(index_t), B2);
+    std::println("Timings:\n\tPattern: {}\n\tRefresh: {}", duration_cast<microseconds>(T1 - T0), duration_cast<microseconds>(T2 - T1));
+    std::println("Layouts, slots and difference, in machine epsilons:");
+
+    for(const auto& [St2, N8, R1]: Vv1)
+        std::println("\t{}: {}, {:.3e}", St2, N8, R1);
+
+    std::println("\tTolerance: {:.3e}, passed: {}", R0, B5);
+    std::println("---");
+
+    // Clean-up.
+    delete[] Nv2; delete[] Nv3; delete[] Rv1;
+    delete[] Nv4; delete[] Nv5; delete[] Rv2;
+    delete[] Nv6;
+    delete[] Nv7; delete[] Nv8; delete[] Rv3;
+    delete[] Nv11; delete[] Nv12;
+    delete[] Nv13; delete[] Nv14; delete[] Rv7;
+
+    for(natural_t N8 = 0; N8 < Vv0.size(); ++N8) {
+        delete[] Dv0[N8 + 1].Rv0;
+        delete[] Dv0[N8 + 1].Rv1;
+    }
+
+    internal::Cld_Dv_0(Dv0);
+
+    return B5;
+}
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    if(argc < 2) {
+        std::println("Usage: {} St [String, path] R? [Real, Tolerance, machine epsilons]", argv[0]);
+        return -1;
+    }
+
+    const real_t R0 = argc > 2 ? std::atof(argv[2]) : 16.0;
+
+    // Entries, original ordering, and refreshed values.
+    const auto [N0, N1, Nv0, Nv1, Rv0, B0] = internal::Coo_St_NNNvNvRvB(argv[1]);
+
+    real_t* Rv1 = new real_t[N1];
+
+    for(natural_t N2 = 0; N2 < N1; ++N2)
+        Rv1[N2] = 0.5 + static_cast<real_t>(std::rand()) / RAND_MAX;
+
+    // Refreshed file, the same entries with the new values.
+    const std::string St0 = (std::filesystem::temp_directory_path() / (std::filesystem::path(argv[1]).stem().string() + ".refresh.mtx")).string();
+
+    if(!Wr_StNNNvNvRvB_B(St0, N0, N1, Nv0, Nv1, Rv1, B0)) {
+        std::println("Unable to write {}", St0);
+        return -1;
+    }
+
+    // Expanded entries, symmetric ones mirrored off the diagonal.
+    natural_t N2 = N1;
+
+    if(B0)
+        for(natural_t N3 = 0; N3 < N1; ++N3)
+            N2 += Nv0[N3] != Nv1[N3];
+
+    // Both index types and, for symmetric matrices, both storages.
+    bool B1 = Test<natural_t>(argv[1], St0, N1, Nv0, Nv1, Rv1, B0, false, R0);
+
+    if(internal::Nrw_NN_B(N0, N2))
+        B1 = Test<natural32_t>(argv[1], St0, N1, Nv0, Nv1, Rv1, B0, false, R0) && B1;
+
+    if(B0)
+        B1 = Test<natural_t>(argv[1], St0, N1, Nv0, Nv1, Rv1, B0, true, R0) && B1;
+
+    std::filesystem::remove(St0);
+
+    // Clean-up.
+    delete[] Nv0; delete[] Nv1; delete[] Rv0;
+    delete[] Rv1;
+
+    return B1 ? 0 : 1;
+}
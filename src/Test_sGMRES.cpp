@@ -10,48 +10,934 @@
 
 #include "./Test.hpp"
 
-int main(int argc, char** argv) {
+#if defined(SINGLE_VALUES) && defined(NEON32)
+#error "Unsafe constant definition."
+#endif
 
-    // Seeding.
-    std::srand(std::time(nullptr));
+// Solver's matrix values, accumulated in real_t.
 
-    // Arguments.
-    if(argc < 3) {
-        std::println("Usage: {} St [String, path] N [Natural, Subspace dimension] N? [Natural, Arnoldi]", argv[0]);
-        return -1;
-    }
+#ifdef SINGLE_VALUES
+using stored_t = value32_t;
+#else
+using stored_t = real_t;
+#endif
 
 
-    // TIMED.
+/**
+ * @brief Solver's (CSC) sparse matrix: the loaded one, its first-touch copy or its reordering.
+ * 
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+struct system_t {
+    const index_t* Nv0; // Pointers.
+    const index_t* Nv1; // Rows.
+    const real_t* Rv0; // Values.
 
+    natural_t N0; // Splitting, parts.
+    const natural_t* Nv2; // Splitting.
+    const natural_t* Nv3; // Splitting.
 
-    // Start.
+    const natural_t* Nv4; // New to old indices, or nullptr.
+    bool B0; // Copied, pages not local.
+
+    duration<real_t> D0; // Reordering.
+    natural_t N1, N2; // Bandwidth, before and after the reordering.
+    natural_t N3, N4; // Profile, before and after the reordering.
+};
+
+
+/**
+ * @brief Reverse Cuthill-McKee reordering of a (CSC) sparse matrix, the solver works on the permuted matrix.
+ * 
+ * @param N0 Natural number [N].
+ * @param Nv0 Natural vector [Nv].
+ * @param Nv1 Natural vector [Nv].
+ * @param Rv0 Real vector [Rv].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return system_t<index_t> System [Sy].
+ */
+template<typename index_t>
+system_t<index_t> Rcm_NNvNvRvB_Sy(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const bool& B0) {
     const auto T0 = high_resolution_clock::now();
 
-    // Sparse matrix.
-    const auto [N0, Nv0, Nv1, Rv0] = internal::Spc_St_NNvNvRv(argv[1]);
+    const natural_t* Nv2 = internal::Rcm_NNvNv_Nv(N0, Nv0, Nv1);
+    const auto [Nv3, Nv4, Rv1] = internal::Prm_NNvNvRvNvB_NvNvRv(N0, Nv0, Nv1, Rv0, Nv2, B0);
+    const auto [N1, Nv5, Nv6] = B0 ? internal::Sps_NNvNvCv_NNvNv(N0, Nv3, Nv4, nullptr) : internal::Spl_NNvNv_NNvNv(N0, Nv3, Nv4);
 
-    // End.
     const auto T1 = high_resolution_clock::now();
 
+    // Bandwidth and profile, before and after.
+    const auto [N2, N3] = internal::Bnd_NNvNv_NN(N0, Nv0, Nv1);
+    const auto [N4, N5] = internal::Bnd_NNvNv_NN(N0, Nv3, Nv4);
+
+    return {Nv3, Nv4, Rv1, N1, Nv5, Nv6, Nv2, false, T1 - T0, N2, N4, N3, N5};
+}
+
+
+/**
+ * @brief Places a (CSC) sparse matrix for the solver: memory-mapped matrices are used in place when their pages are local to every thread, otherwise copied, first touched by the threads owning their columns.
+ * 
+ * @param N0 Natural number [N].
+ * @param Nv0 Natural vector [Nv].
+ * @param Nv1 Natural vector [Nv].
+ * @param Rv0 Real vector [Rv].
+ * @param B0 Boolean [B], memory-mapped.
+ * @param N1 Natural number [N], from Spl_NNvNv_NNvNv or Sps_NNvNvCv_NNvNv.
+ * @param Nv2 Natural vector [Nv], from Spl_NNvNv_NNvNv or Sps_NNvNvCv_NNvNv.
+ * @param Nv3 Natural vector [Nv], from Spl_NNvNv_NNvNv or Sps_NNvNvCv_NNvNv.
+ * @tparam index_t Index type.
+ * @return system_t<index_t> System [Sy], sharing the splitting.
+ */
+template<typename index_t>
+system_t<index_t> Ftc_NNvNvRvBNNvNv_Sy(const natural_t& N0, const index_t* Nv0, const index_t* Nv1, const real_t* Rv0, const bool& B0, const natural_t& N1, const natural_t* Nv2, const natural_t* Nv3) {
+    const bool B1 = B0 && !(internal::Lcl_CvN_B(Nv1, Nv0[N0] * sizeof(index_t)) && internal::Lcl_CvN_B(Rv0, Nv0[N0] * sizeof(real_t)));
+    const auto [Nv4, Nv5, Rv1] = B1 ? internal::Ftc_NNvNvRvN_NvNvRv(N0, Nv0, Nv1, Rv0, N1) : std::tuple<const index_t*, const index_t*, const real_t*>{Nv0, Nv1, Rv0};
+
+    return {Nv4, Nv5, Rv1, N1, Nv2, Nv3, nullptr, B1, duration<real_t>::zero(), 0, 0, 0, 0};
+}
+
+
+/**
+ * @brief Releases a system_t, the loaded matrix and a shared splitting excluded.
+ * 
+ * @param Sy0 System [Sy].
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Cls_Sy_0(const system_t<index_t>& Sy0) {
+    if(Sy0.B0 || Sy0.Nv4 != nullptr) {
+        delete[] Sy0.Nv0; delete[] Sy0.Nv1; delete[] Sy0.Rv0;
+    }
+
+    if(Sy0.Nv4 != nullptr) {
+        delete[] Sy0.Nv2; delete[] Sy0.Nv3; delete[] Sy0.Nv4;
+    }
+}
+
+
+/**
+ * @brief Values of a system_t as multiplied by the solver's operator, narrowed into a copy below real_t.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @tparam index_t Index type.
+ * @return const stored_t* Real vector [Rv], the values of Sy0 themselves for real_t.
+ */
+template<typename index_t>
+const stored_t* Vls_NSy_Rv(const natural_t& N0, const system_t<index_t>& Sy0) {
+    if constexpr(std::is_same_v<stored_t, real_t>)
+        return Sy0.Rv0;
+    else
+        return internal::Nrw_RvN_Rv<stored_t>(Sy0.Rv0, Sy0.Nv0[N0]);
+}
+
+
+/**
+ * @brief Releases values from Vls_NSy_Rv.
+ * 
+ * @param Rv0 Real vector [Rv].
+ */
+void Clv_Rv_0(const stored_t* Rv0) {
+    if constexpr(!std::is_same_v<stored_t, real_t>)
+        delete[] Rv0;
+}
+
+
+/**
+ * @brief Sketched GMRES on a system_t, permuting the vectors around the solve when reordered.
+ * 
+ * @param Rvt0 Real vector [Rv], target [t].
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Op0 Operator [Op].
+ * @param Of0 Fused operator [Of], possibly empty.
+ * @param Pw0 Matrix powers [Pw], possibly empty.
+ * @param Rv0 Real vector [Rv].
+ * @param N1 Natural number [N].
+ * @param N2 Natural number [N].
+ * @tparam index_t Index type.
+ * @tparam scalar_t Scalar type.
+ * @return std::array<scalar_t, 2> Real numbers [R].
+ */
+template<typename index_t, typename scalar_t>
+std::array<scalar_t, 2> sGMRES_RvNSyOpOfPwRvNN_RR(scalar_t* Rvt0, const natural_t& N0, const system_t<index_t>& Sy0, const internal::operator_t<scalar_t>& Op0, const internal::fused_t<scalar_t>& Of0, const internal::powers_t<scalar_t>& Pw0, const scalar_t* Rv0, const natural_t& N1, const natural_t& N2) {
+    if(Sy0.Nv4 != nullptr)
+        return internal::sGMRES_RvNNvOpOfPwRvNN_RR(Rvt0, N0, Sy0.Nv4, Op0, Of0, Pw0, Rv0, N1, N2);
+
+    return internal::sGMRES_RvNOpOfPwRvNN_RR(Rvt0, N0, Op0, Of0, Pw0, Rv0, N1, N2);
+}
+
+
+/**
+ * @brief Applies a solver's operator to a real_t*, in its scalar type, possibly on the permuted system.
+ * 
+ * @param Rvt0 Real vector [Rv], target [t], overwritten.
+ * @param Op0 Operator [Op].
+ * @param Rv0 Real vector [Rv].
+ * @param N0 Natural number [N].
+ * @param Nv0 Natural vector [Nv], new to old indices, or nullptr.
+ * @tparam scalar_t Scalar type.
+ */
+template<typename scalar_t>
+void Op_RvtOpRvNNv_0(real_t* Rvt0, const internal::operator_t<scalar_t>& Op0, const real_t* Rv0, const natural_t& N0, const natural_t* Nv0) {
+    scalar_t* Rv1 = new scalar_t[N0];
+    scalar_t* Rv2 = new scalar_t[N0]();
+
+    for(natural_t N1 = 0; N1 < N0; ++N1)
+        Rv1[N1] = static_cast<scalar_t>(Rv0[Nv0 != nullptr ? Nv0[N1] : N1]);
+
+    Op0(Rv2, Rv1);
+
+    for(natural_t N1 = 0; N1 < N0; ++N1)
+        Rvt0[Nv0 != nullptr ? Nv0[N1] : N1] = static_cast<real_t>(Rv2[N1]);
+
+    delete[] Rv1; delete[] Rv2;
+}
+
+
+/**
+ * @brief Solver's operator, parallel (CSC) or symmetric (lower) storage, shared by every layout and precision.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], values.
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam scalar_t Scalar type.
+ * @tparam index_t Index type.
+ * @tparam value_t Value type.
+ * @return internal::operator_t<scalar_t> Operator [Op].
+ */
+template<typename scalar_t, typename index_t, typename value_t>
+internal::operator_t<scalar_t> Op_NSyRvB_Op(const natural_t& N0, const system_t<index_t>& Sy0, const value_t* Rv0, const bool& B0) {
+    return [&, Rv0, B0, Rv2 = std::vector<scalar_t>()](scalar_t* Rvt0, const scalar_t* Rv1) mutable {
+        if(B0)
+            internal::Mls_RvtNNvNvRvRvNNvNvRvt_0(Rvt0, N0, Sy0.Nv0, Sy0.Nv1, Rv0, Rv1, Sy0.N0, Sy0.Nv2, Sy0.Nv3, Rv2);
+        else
+            internal::Mlc_RvtNNvNvRvRvNNvNvRvt_0(Rvt0, N0, Sy0.Nv0, Sy0.Nv1, Rv0, Rv1, Sy0.N0, Sy0.Nv2, Sy0.Nv3, Rv2);
+    };
+}
+
+
+/**
+ * @brief Solver's fused operator, parallel (CSC), empty for symmetric (lower) storage.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], values.
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam scalar_t Scalar type.
+ * @tparam index_t Index type.
+ * @tparam value_t Value type.
+ * @return internal::fused_t<scalar_t> Fused operator [Of].
+ */
+template<typename scalar_t, typename index_t, typename value_t>
+internal::fused_t<scalar_t> Of_NSyRvB_Of(const natural_t& N0, const system_t<index_t>& Sy0, const value_t* Rv0, const bool& B0) {
+    if(B0)
+        return {};
+
+    return [&, Rv0, Rv3 = std::vector<scalar_t>()](scalar_t* Rvt0, scalar_t* Rvt1, const scalar_t* Rv1, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, const scalar_t* Rv2) mutable {
+        internal::Mlk_RvtRvtNNvNvRvRvNNvNvNNvNvRvRvt_0(Rvt0, Rvt1, N0, Sy0.Nv0, Sy0.Nv1, Rv0, Rv1, Sy0.N0, Sy0.Nv2, Sy0.Nv3, N1, Nv0, Nv1, Rv2, Rv3);
+    };
+}
+
+
+// Solver's layout, one per flag, built, multiplied, reported and released through the same calls.
+
+#if defined(DELTA_INDICES)
+
+/**
+ * @brief Delta-encoded row indices of a system_t.
+ * 
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+struct layout_t {
+    unsigned char* Cv0; // Encoding, or nullptr.
+    natural_t N0; // Encoding, bytes.
+
+    natural_t N1; // Column splitting, parts, symmetric (lower) storage.
+    natural_t* Nv0; // Column splitting.
+    natural_t* Nv1; // Column splitting.
+};
+
+
+/**
+ * @brief Delta-encodes the row indices of a system_t, single-precision solves excluded.
+ * 
+ * @param St0 String [St], decision cache, unused.
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ * @return layout_t<index_t> Layout [Ly].
+ */
+template<typename index_t>
+layout_t<index_t> Lyt_StNSyBB_Ly(const std::string& St0, const natural_t& N0, const system_t<index_t>& Sy0, const bool& B0, const bool& B1) {
+    const auto [Cv0, N1] = B1 ? std::tuple<unsigned char*, natural_t>{nullptr, 0} : internal::Dlt_NNvNv_CvN(N0, Sy0.Nv0, Sy0.Nv1);
+    const auto [N2, Nv0, Nv1] = B0 && !B1 ? internal::Sps_NNvNvCv_NNvNv(N0, Sy0.Nv0, Sy0.Nv1, Cv0) : std::tuple<natural_t, natural_t*, natural_t*>{1, nullptr, nullptr};
+
+    return {Cv0, N1, N2, Nv0, Nv1};
+}
+
+
+/**
+ * @brief Solver's operator, delta-encoded rows.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], from Vls_NSy_Rv.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return internal::operator_t<real_t> Operator [Op].
+ */
+template<typename index_t>
+internal::operator_t<real_t> Op_NSyRvLyB_Op(const natural_t& N0, const system_t<index_t>& Sy0, const stored_t* Rv0, const layout_t<index_t>& Ly0, const bool& B0) {
+    return [&, Rv0, Rv2 = std::vector<real_t>()](real_t* Rvt0, const real_t* Rv1) mutable {
+        if(B0)
+            internal::Mls_RvtNNvCvRvRvNNvNvRvt_0(Rvt0, N0, Sy0.Nv0, Ly0.Cv0, Rv0, Rv1, Ly0.N1, Ly0.Nv0, Ly0.Nv1, Rv2);
+        else
+            internal::Mlc_RvtNNvCvRvRv_0(Rvt0, N0, Sy0.Nv0, Ly0.Cv0, Rv0, Rv1);
+    };
+}
+
+
+/**
+ * @brief Solver's fused operator, none for delta-encoded rows.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], from Vls_NSy_Rv.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return internal::fused_t<real_t> Fused operator [Of], empty.
+ */
+template<typename index_t>
+internal::fused_t<real_t> Of_NSyRvLyB_Of(const natural_t& N0, const system_t<index_t>& Sy0, const stored_t* Rv0, const layout_t<index_t>& Ly0, const bool& B0) {
+    return {};
+}
+
+
+/**
+ * @brief Reports a layout_t.
+ * 
+ * @param N0 Natural number [N].
+ * @param N1 Natural number [N], nonzeros.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Rpt_NNLyBB_0(const natural_t& N0, const natural_t& N1, const layout_t<index_t>& Ly0, const bool& B0, const bool& B1) {
+    if(!B1)
+        std::println("\tIndices, delta-encoded: {:.3e} B/nnz", static_cast<real_t>(Ly0.N0) / N1);
+}
+
+
+/**
+ * @brief Releases a layout_t.
+ * 
+ * @param Ly0 Layout [Ly].
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Cly_Ly_0(const layout_t<index_t>& Ly0) {
+    delete[] Ly0.Cv0;
+    delete[] Ly0.Nv0; delete[] Ly0.Nv1;
+}
+
+#elif defined(SELL_FORMAT)
+
+/**
+ * @brief Sliced ELLPACK layout of a system_t.
+ * 
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+struct layout_t {
+    natural_t* Nv0; // Rows, or nullptr.
+    natural_t* Nv1; // Chunk pointers.
+    index_t* Nv2; // Columns.
+    real_t* Rv0; // Values.
+};
+
+
+/**
+ * @brief Slices a system_t, general storage and double-precision solves only.
+ * 
+ * @param St0 String [St], decision cache, unused.
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ * @return layout_t<index_t> Layout [Ly].
+ */
+template<typename index_t>
+layout_t<index_t> Lyt_StNSyBB_Ly(const std::string& St0, const natural_t& N0, const system_t<index_t>& Sy0, const bool& B0, const bool& B1) {
+    if(B0 || B1)
+        return {nullptr, nullptr, nullptr, nullptr};
+
+    const auto [Nv0, Nv1, Nv2, Rv0] = internal::Sel_NNvNvRv_NvNvNvRv(N0, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0);
+
+    return {Nv0, Nv1, Nv2, Rv0};
+}
+
+
+/**
+ * @brief Solver's operator, Sliced ELLPACK, or the shared one when not sliced.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], from Vls_NSy_Rv.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return internal::operator_t<real_t> Operator [Op].
+ */
+template<typename index_t>
+internal::operator_t<real_t> Op_NSyRvLyB_Op(const natural_t& N0, const system_t<index_t>& Sy0, const stored_t* Rv0, const layout_t<index_t>& Ly0, const bool& B0) {
+    if(Ly0.Nv1 == nullptr)
+        return Op_NSyRvB_Op<real_t>(N0, Sy0, Rv0, B0);
+
+    return [&](real_t* Rvt0, const real_t* Rv1) {
+        internal::Mle_RvtNNvNvNvRvRv_0(Rvt0, N0, Ly0.Nv0, Ly0.Nv1, Ly0.Nv2, Ly0.Rv0, Rv1);
+    };
+}
+
+
+/**
+ * @brief Solver's fused operator, none for Sliced ELLPACK.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], from Vls_NSy_Rv.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return internal::fused_t<real_t> Fused operator [Of], empty.
+ */
+template<typename index_t>
+internal::fused_t<real_t> Of_NSyRvLyB_Of(const natural_t& N0, const system_t<index_t>& Sy0, const stored_t* Rv0, const layout_t<index_t>& Ly0, const bool& B0) {
+    return {};
+}
+
+
+/**
+ * @brief Reports a layout_t.
+ * 
+ * @param N0 Natural number [N].
+ * @param N1 Natural number [N], nonzeros.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Rpt_NNLyBB_0(const natural_t& N0, const natural_t& N1, const layout_t<index_t>& Ly0, const bool& B0, const bool& B1) {
+    if(Ly0.Nv1 != nullptr)
+        std::println("\tSELL-C-σ: C = {}, σ = {}, fill {:.3e}", internal::sell_chunk, internal::sell_sigma, static_cast<real_t>(N1) / Ly0.Nv1[(N0 + internal::sell_chunk - 1) / internal::sell_chunk]);
+}
+
+
+/**
+ * @brief Releases a layout_t.
+ * 
+ * @param Ly0 Layout [Ly].
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Cly_Ly_0(const layout_t<index_t>& Ly0) {
+    delete[] Ly0.Nv0; delete[] Ly0.Nv1; delete[] Ly0.Nv2; delete[] Ly0.Rv0;
+}
+
+#else
+
+/**
+ * @brief Autotuned kernel of a system_t and its layout, only the one of the kernel being built.
+ * 
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+struct layout_t {
+    internal::kernel_t K0; // Kernel.
+    bool B0; // Loaded from the decision cache.
+
+    natural_t N0; // (BCSR), block size, 1 when unblocked.
+    index_t* Nv0; // (BCSR), pointers.
+    index_t* Nv1; // (BCSR), columns.
+    real_t* Rv0; // (BCSR), values.
+
+    natural_t N1; // (DIA), diagonals.
+    integer_t* Iv0; // (DIA), offsets.
+    real_t* Rv1; // (DIA), values.
+
+    index_t* Nv2; // (CSR), pointers.
+    index_t* Nv3; // (CSR), columns.
+    real_t* Rv2; // (CSR), values.
+
+    natural_t* Nv4; // (SELL-C-σ), rows.
+    natural_t* Nv5; // (SELL-C-σ), chunk pointers.
+    index_t* Nv6; // (SELL-C-σ), columns.
+    real_t* Rv3; // (SELL-C-σ), values.
+
+    unsigned char* Cv0; // Delta-encoded rows.
+    natural_t N2; // Column splitting, parts, delta-encoded symmetric (lower) storage.
+    natural_t* Nv7; // Column splitting.
+    natural_t* Nv8; // Column splitting.
+};
+
+
+/**
+ * @brief Autotunes the kernel of a system_t on full-precision values, the decision being cached next to the matrix, and builds its layout.
+ * The (DIA) layout is detected here, once, and multiplied by the solver through its operators.
+ * Single-values builds and single-precision solves use the parallel (CSC) or symmetric kernel.
+ * 
+ * @param St0 String [St], decision cache.
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ * @return layout_t<index_t> Layout [Ly].
+ */
+template<typename index_t>
+layout_t<index_t> Lyt_StNSyBB_Ly(const std::string& St0, const natural_t& N0, const system_t<index_t>& Sy0, const bool& B0, const bool& B1) {
+    using internal::kernel_t;
+
+    #ifdef SINGLE_VALUES
+    const auto [K0, B2] = std::tuple<kernel_t, bool>{B0 ? kernel_t::symmetric : kernel_t::split, false};
+    #else
+    const auto [K0, B2] = B1 ? std::tuple<kernel_t, bool>{B0 ? kernel_t::symmetric : kernel_t::split, false} : internal::Atn_StNNvNvRvB_KB(St0, N0, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0, B0);
+    #endif
+
+    // Register blocking.
+    const natural_t N1 = K0 == kernel_t::bcsr ? internal::Blk_NNvNv_N(N0, Sy0.Nv0, Sy0.Nv1) : 1;
+    const auto [Nv0, Nv1, Rv0] = N1 > 1 ? internal::Bcr_NNNvNvRv_NvNvRv(N0, N1, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0) : std::tuple<index_t*, index_t*, real_t*>{nullptr, nullptr, nullptr};
+
+    // Diagonals.
+    const auto [N2, Iv0, Rv1] = K0 == kernel_t::dia ? internal::Dia_NNvNvRv_NIvRv(N0, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0) : std::tuple<natural_t, integer_t*, real_t*>{0, nullptr, nullptr};
+
+    // (CSR).
+    const auto [Nv2, Nv3, Rv2] = K0 == kernel_t::csr ? internal::Tr_NNvNvRv_NvNvRv(N0, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0) : std::tuple<index_t*, index_t*, real_t*>{nullptr, nullptr, nullptr};
+
+    // Sliced ELLPACK.
+    const auto [Nv4, Nv5, Nv6, Rv3] = K0 == kernel_t::sell ? internal::Sel_NNvNvRv_NvNvNvRv(N0, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0) : std::tuple<natural_t*, natural_t*, index_t*, real_t*>{nullptr, nullptr, nullptr, nullptr};
+
+    // Delta-encoded row indices.
+    const auto [Cv0, N3] = K0 == kernel_t::delta || K0 == kernel_t::symmetric_delta ? internal::Dlt_NNvNv_CvN(N0, Sy0.Nv0, Sy0.Nv1) : std::tuple<unsigned char*, natural_t>{nullptr, 0};
+    const auto [N4, Nv7, Nv8] = K0 == kernel_t::symmetric_delta ? internal::Sps_NNvNvCv_NNvNv(N0, Sy0.Nv0, Sy0.Nv1, Cv0) : std::tuple<natural_t, natural_t*, natural_t*>{1, nullptr, nullptr};
+
+    return {K0, B2, N1, Nv0, Nv1, Rv0, N2, Iv0, Rv1, Nv2, Nv3, Rv2, Nv4, Nv5, Nv6, Rv3, Cv0, N4, Nv7, Nv8};
+}
+
+
+/**
+ * @brief Solver's operator, tuned kernel, the shared one for the parallel (CSC) and symmetric kernels.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], from Vls_NSy_Rv.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return internal::operator_t<real_t> Operator [Op].
+ */
+template<typename index_t>
+internal::operator_t<real_t> Op_NSyRvLyB_Op(const natural_t& N0, const system_t<index_t>& Sy0, const stored_t* Rv0, const layout_t<index_t>& Ly0, const bool& B0) {
+    if(Ly0.K0 == internal::kernel_t::split || Ly0.K0 == internal::kernel_t::symmetric)
+        return Op_NSyRvB_Op<real_t>(N0, Sy0, Rv0, B0);
+
+    return [&, Rv0, Rv2 = std::vector<real_t>()](real_t* Rvt0, const real_t* Rv1) mutable {
+        switch(Ly0.K0) {
+            case internal::kernel_t::symmetric_delta:
+                internal::Mls_RvtNNvCvRvRvNNvNvRvt_0(Rvt0, N0, Sy0.Nv0, Ly0.Cv0, Rv0, Rv1, Ly0.N2, Ly0.Nv7, Ly0.Nv8, Rv2);
+                break;
+            case internal::kernel_t::csr:
+                internal::Mlr_RvtNNvNvRvRv_0(Rvt0, N0, Ly0.Nv2, Ly0.Nv3, Ly0.Rv2, Rv1);
+                break;
+            case internal::kernel_t::sell:
+                internal::Mle_RvtNNvNvNvRvRv_0(Rvt0, N0, Ly0.Nv4, Ly0.Nv5, Ly0.Nv6, Ly0.Rv3, Rv1);
+                break;
+            case internal::kernel_t::bcsr:
+                internal::Mlb_RvtNNNvNvRvRv_0(Rvt0, N0, Ly0.N0, Ly0.Nv0, Ly0.Nv1, Ly0.Rv0, Rv1);
+                break;
+            case internal::kernel_t::dia:
+                internal::Mld_RvtNNIvRvRv_0(Rvt0, N0, Ly0.N1, Ly0.Iv0, Ly0.Rv1, Rv1);
+                break;
+            default: // Delta-encoded rows.
+                internal::Mlc_RvtNNvCvRvRv_0(Rvt0, N0, Sy0.Nv0, Ly0.Cv0, Rv0, Rv1);
+        }
+    };
+}
+
+
+/**
+ * @brief Solver's fused operator, sketching the products, (DIA) or parallel (CSC), empty for the other kernels.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Rv0 Real vector [Rv], from Vls_NSy_Rv.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @tparam index_t Index type.
+ * @return internal::fused_t<real_t> Fused operator [Of].
+ */
+template<typename index_t>
+internal::fused_t<real_t> Of_NSyRvLyB_Of(const natural_t& N0, const system_t<index_t>& Sy0, const stored_t* Rv0, const layout_t<index_t>& Ly0, const bool& B0) {
+    if(Ly0.K0 == internal::kernel_t::split)
+        return Of_NSyRvB_Of<real_t>(N0, Sy0, Rv0, B0);
+
+    if(Ly0.K0 != internal::kernel_t::dia)
+        return {};
+
+    return [&, Rv3 = std::vector<real_t>()](real_t* Rvt0, real_t* Rvt1, const real_t* Rv1, const natural_t& N1, const natural_t* Nv0, const natural_t* Nv1, const real_t* Rv2) mutable {
+        internal::Mdk_RvtRvtNNIvRvRvNNvNvRvRvt_0(Rvt0, Rvt1, N0, Ly0.N1, Ly0.Iv0, Ly0.Rv1, Rv1, N1, Nv0, Nv1, Rv2, Rv3);
+    };
+}
+
+
+/**
+ * @brief Reports a layout_t.
+ * 
+ * @param N0 Natural number [N].
+ * @param N1 Natural number [N], nonzeros.
+ * @param Ly0 Layout [Ly].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Rpt_NNLyBB_0(const natural_t& N0, const natural_t& N1, const layout_t<index_t>& Ly0, const bool& B0, const bool& B1) {
+    #ifdef SINGLE_VALUES
+    if(!B1)
+        std::println("\tKernel: {}", internal::Nm_K_St(Ly0.K0));
+    #else
+    if(!B1)
+        std::println("\tKernel: {}, {}", internal::Nm_K_St(Ly0.K0), Ly0.B0 ? "cached" : "tuned");
+    #endif
+
+    if(Ly0.N0 > 1)
+        std::println("\tBlocks: {} x {}, fill {:.3e}", Ly0.N0, Ly0.N0, static_cast<real_t>(N1) / (Ly0.Nv0[N0 / Ly0.N0] * Ly0.N0 * Ly0.N0));
+
+    if(Ly0.N1 > 0)
+        std::println("\tDiagonals: {}, fill {:.3e}", Ly0.N1, static_cast<real_t>(N1) / (Ly0.N1 * N0));
+}
+
+
+/**
+ * @brief Releases a layout_t.
+ * 
+ * @param Ly0 Layout [Ly].
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Cly_Ly_0(const layout_t<index_t>& Ly0) {
+    delete[] Ly0.Nv0; delete[] Ly0.Nv1; delete[] Ly0.Rv0;
+    delete[] Ly0.Iv0; delete[] Ly0.Rv1;
+    delete[] Ly0.Nv2; delete[] Ly0.Nv3; delete[] Ly0.Rv2;
+    delete[] Ly0.Nv4; delete[] Ly0.Nv5; delete[] Ly0.Nv6; delete[] Ly0.Rv3;
+    delete[] Ly0.Cv0;
+    delete[] Ly0.Nv7; delete[] Ly0.Nv8;
+}
+
+#endif
+
+#ifdef MATRIX_POWERS
+
+/**
+ * @brief Matrix powers of a system_t, (CSR) general storage.
+ * 
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+struct matpow_t {
+    index_t* Nv0; // (CSR), pointers, or nullptr.
+    index_t* Nv1; // (CSR), columns.
+    real_t* Rv0; // (CSR), values.
+
+    natural_t N0; // Blocks.
+    natural_t* Nv2; // Partition.
+
+    real_t R0; // Redundancy of the partition.
+    real_t R1; // Scaling of the powers.
+    real_t R2; // Speedup of a sweep over the operator.
+
+    bool B0; // Used by the solver.
+};
+
+
+/**
+ * @brief Solver's matrix powers, scaled Newton basis, empty when unused.
+ * 
+ * @param N0 Natural number [N].
+ * @param Mp0 Matrix powers [Mp].
+ * @tparam index_t Index type.
+ * @return internal::powers_t<real_t> Matrix powers [Pw].
+ */
+template<typename index_t>
+internal::powers_t<real_t> Pw_NMp_Pw(const natural_t& N0, const matpow_t<index_t>& Mp0) {
+    if(!Mp0.B0)
+        return {};
+
+    return [&](real_t* Rmt0, const real_t* Rv0, const real_t* Rv1, const natural_t& N1) {
+        internal::Mpk_RmtNNvNvRvRvRvNNNvR_0(Rmt0, N0, Mp0.Nv0, Mp0.Nv1, Mp0.Rv0, Rv0, Rv1, N1, Mp0.N0, Mp0.Nv2, Mp0.R1);
+        return Mp0.R1;
+    };
+}
+
+
+/**
+ * @brief Speedup of a sweep of the matrix powers over powers_steps products of the operator, fastest runs on a random vector, unshifted.
+ * 
+ * @param N0 Natural number [N].
+ * @param Op0 Operator [Op].
+ * @param Pw0 Matrix powers [Pw].
+ * @return real_t Real number [R].
+ */
+real_t Swp_NOpPw_R(const natural_t& N0, const internal::operator_t<real_t>& Op0, const internal::powers_t<real_t>& Pw0) {
+    duration<real_t> D0 = duration<real_t>::max(), D1 = duration<real_t>::max();
+
+    real_t* Rv0 = new real_t[N0];
+    real_t* Rm0 = new real_t[N0 * internal::powers_steps];
+    real_t* Rv1 = new real_t[internal::powers_steps]();
+
+    for(natural_t N1 = 0; N1 < N0; ++N1)
+        Rv0[N1] = static_cast<real_t>(std::rand()) / RAND_MAX - 0.5;
+
+    for(natural_t N1 = 0; N1 < internal::powers_iterations; ++N1) {
+        const auto T0 = high_resolution_clock::now();
+
+        for(natural_t N2 = 0; N2 < internal::powers_steps; ++N2) {
+            std::fill_n(Rm0 + N2 * N0, N0, 0.0);
+            Op0(Rm0 + N2 * N0, N2 == 0 ? Rv0 : Rm0 + (N2 - 1) * N0);
+        }
+
+        const auto T1 = high_resolution_clock::now();
+
+        Pw0(Rm0, Rv0, Rv1, internal::powers_steps);
+
+        const auto T2 = high_resolution_clock::now();
+
+        D0 = std::min<duration<real_t>>(D0, T1 - T0);
+        D1 = std::min<duration<real_t>>(D1, T2 - T1);
+    }
+
+    delete[] Rv0; delete[] Rm0; delete[] Rv1;
+
+    return D0.count() / D1.count();
+}
+
+
+/**
+ * @brief Builds the matrix powers of a system_t, general storage and double-precision solves only.
+ * They are used within powers_redundancy and when faster than the operator, unless forced.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Op0 Operator [Op], the solver's.
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ * @return matpow_t<index_t> Matrix powers [Mp].
+ */
+template<typename index_t>
+matpow_t<index_t> Mpw_NSyOpBB_Mp(const natural_t& N0, const system_t<index_t>& Sy0, const internal::operator_t<real_t>& Op0, const bool& B0, const bool& B1) {
+    if(B0 || B1)
+        return {nullptr, nullptr, nullptr, 0, nullptr, 0.0, 1.0, 0.0, false};
+
+    const auto [Nv0, Nv1, Rv0] = internal::Tr_NNvNvRv_NvNvRv(N0, Sy0.Nv0, Sy0.Nv1, Sy0.Rv0);
+    const auto [N1, Nv2] = internal::Pwp_NNvNv_NNv(N0, Nv0, Nv1);
+
+    matpow_t<index_t> Mp0{Nv0, Nv1, Rv0, N1, Nv2, internal::Pwr_NNNv_R(N0, N1, Nv2), internal::Pws_NNvRv_R(N0, Nv0, Rv0), 0.0, true};
+
+    // Matrix powers, within powers_redundancy unless forced.
+    #ifndef FORCE_POWERS
+    Mp0.B0 = Mp0.R0 <= internal::powers_redundancy;
+    #endif
+
+    if(Mp0.B0)
+        Mp0.R2 = Swp_NOpPw_R(N0, Op0, Pw_NMp_Pw(N0, Mp0));
+
+    // The plain operator being used when faster unless forced.
+    #ifndef FORCE_POWERS
+    Mp0.B0 = Mp0.R2 > 1.0;
+    #endif
+
+    return Mp0;
+}
+
+
+/**
+ * @brief Releases a matpow_t.
+ * 
+ * @param Mp0 Matrix powers [Mp].
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Clp_Mp_0(const matpow_t<index_t>& Mp0) {
+    delete[] Mp0.Nv0; delete[] Mp0.Nv1; delete[] Mp0.Rv0;
+    delete[] Mp0.Nv2;
+}
+
+
+/**
+ * @brief Reports a matpow_t.
+ * 
+ * @param Mp0 Matrix powers [Mp].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Rpt_MpBB_0(const matpow_t<index_t>& Mp0, const bool& B0, const bool& B1) {
+    if(Mp0.B0)
+        std::println("\tMatrix powers: {} steps, {} blocks, redundancy {:.3e}, scaling {:.3e}, speedup {:.3e}", internal::powers_steps, Mp0.N0, Mp0.R0, Mp0.R1, Mp0.R2);
+    else if(!B0 && !B1)
+        std::println("\tMatrix powers: plain operator, redundancy {:.3e}, speedup {:.3e}", Mp0.R0, Mp0.R2);
+}
+
+#else
+
+/**
+ * @brief No matrix powers, the solver multiplies by its operator only.
+ * 
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+struct matpow_t {};
+
+
+/**
+ * @brief No matrix powers to build.
+ * 
+ * @param N0 Natural number [N].
+ * @param Sy0 System [Sy].
+ * @param Op0 Operator [Op], the solver's.
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ * @return matpow_t<index_t> Matrix powers [Mp], empty.
+ */
+template<typename index_t>
+matpow_t<index_t> Mpw_NSyOpBB_Mp(const natural_t& N0, const system_t<index_t>& Sy0, const internal::operator_t<real_t>& Op0, const bool& B0, const bool& B1) {
+    return {};
+}
+
+
+/**
+ * @brief Solver's matrix powers, empty.
+ * 
+ * @param N0 Natural number [N].
+ * @param Mp0 Matrix powers [Mp].
+ * @tparam index_t Index type.
+ * @return internal::powers_t<real_t> Matrix powers [Pw], empty.
+ */
+template<typename index_t>
+internal::powers_t<real_t> Pw_NMp_Pw(const natural_t& N0, const matpow_t<index_t>& Mp0) {
+    return {};
+}
+
+
+/**
+ * @brief Nothing to report.
+ * 
+ * @param Mp0 Matrix powers [Mp].
+ * @param B0 Boolean [B], symmetric (lower) storage.
+ * @param B1 Boolean [B], single-precision solve.
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Rpt_MpBB_0(const matpow_t<index_t>& Mp0, const bool& B0, const bool& B1) {}
+
+
+/**
+ * @brief Nothing to release.
+ * 
+ * @param Mp0 Matrix powers [Mp].
+ * @tparam index_t Index type.
+ */
+template<typename index_t>
+void Clp_Mp_0(const matpow_t<index_t>& Mp0) {}
+
+#endif
+
+
+/**
+ * @brief sGMRES testing on a loaded (CSC) sparse matrix, through the layout of the flags being built.
+ * 
+ * @param argc Natural number [N].
+ * @param argv Strings [St].
+ * @param Sp0 (CSC) sparse matrix [Spc], symmetric (lower) storage.
+ * @param St0 String [St], binary cache.
+ * @param B1 Boolean [B], loaded from the binary cache.
+ * @param B5 Boolean [B], threads pinned.
+ * @param D2 Loading duration.
+ * @tparam index_t Index type.
+ * @return int Exit code.
+ */
+template<typename index_t>
+int Test(int argc, char** argv, const std::tuple<natural_t, const index_t*, const index_t*, const real_t*, bool>& Sp0, const std::string& St0, const bool& B1, const bool& B5, const duration<real_t>& D2) {
+    const auto [N0, Nv0, Nv1, Rv0, B3] = Sp0;
 
     // TIMED.
 
+    // Binary cache.
+    const bool B2 = B1 || internal::Stb_StNNvNvRvB_B(St0, N0, Nv0, Nv1, Rv0, B3);
+
+    // Row or column splitting, parallel (CSC) or symmetric products.
+    const auto [N5, Nv2, Nv3] = B3 ? internal::Sps_NNvNvCv_NNvNv(N0, Nv0, Nv1, nullptr) : internal::Spl_NNvNv_NNvNv(N0, Nv0, Nv1);
+
+    // Loaded matrix, in place, and its operator, general or symmetric (lower) storage.
+    const system_t<index_t> Sy1 = Ftc_NNvNvRvBNNvNv_Sy(N0, Nv0, Nv1, Rv0, false, N5, Nv2, Nv3);
+    const internal::operator_t<real_t> Op1 = Op_NSyRvB_Op<real_t>(N0, Sy1, Rv0, B3);
+
+    // Solver's matrix, reordered or placed.
+    #ifdef RCM_ORDERING
+    const system_t<index_t> Sy0 = Rcm_NNvNvRvB_Sy(N0, Nv0, Nv1, Rv0, B3);
+    #else
+    const system_t<index_t> Sy0 = Ftc_NNvNvRvBNNvNv_Sy(N0, Nv0, Nv1, Rv0, B1, N5, Nv2, Nv3);
+    #endif
+
     // Parameters.
     const natural_t N1 = std::atoi(argv[2]);
     const natural_t N2 = argc > 3 ? std::atoi(argv[3]) : 4;
+    const natural_t N13 = argc > 4 ? std::atoi(argv[4]) : 64;
+
+    // Single-precision solves use the shared operator only, no other layout is built.
+    const bool B7 = N13 == 32;
+
+    // Solver's values, layout and operators.
+    const stored_t* Rv6 = Vls_NSy_Rv(N0, Sy0);
+    const layout_t<index_t> Ly0 = Lyt_StNSyBB_Ly(std::string(argv[1]) + ".tune", N0, Sy0, B3, B7);
+    const internal::operator_t<real_t> Op0 = Op_NSyRvLyB_Op(N0, Sy0, Rv6, Ly0, B3);
+    const internal::fused_t<real_t> Of0 = Of_NSyRvLyB_Of(N0, Sy0, Rv6, Ly0, B3);
+
+    // Solver's matrix powers.
+    const matpow_t<index_t> Mp0 = Mpw_NSyOpBB_Mp(N0, Sy0, Op0, B3, B7);
+    const internal::powers_t<real_t> Pw0 = Pw_NMp_Pw(N0, Mp0);
+
+    // Single-precision solver's values and operators.
+    const float* Rv18 = B7 ? internal::Nrw_RvN_Rv<float>(Sy0.Rv0, Sy0.Nv0[N0]) : nullptr;
+    const internal::operator_t<float> Op2 = Op_NSyRvB_Op<float>(N0, Sy0, Rv18, B3);
+    const internal::fused_t<float> Of1 = Of_NSyRvB_Of<float>(N0, Sy0, Rv18, B3);
 
     // Solution.
-    real_t* Rv1 = new real_t[N0];
+    real_t* Rv1 = new real_t[N0]();
 
     // Expected solution.
     real_t* Rv2 = new real_t[N0];
 
     // RHS.
-    real_t* Rv3 = new real_t[N0];
+    real_t* Rv3 = new real_t[N0]();
 
     // Residual.
-    real_t* Rv4 = new real_t[N0];
+    real_t* Rv4 = new real_t[N0]();
 
     // Expected solution.
     for(natural_t N3 = 0; N3 < N0; ++N3) {
@@ -61,7 +947,7 @@ int main(int argc, char** argv) {
     }
 
     // RHS.
-    internal::Mlc_RvtNNvNvRvRv_0(Rv3, N0, Nv0, Nv1, Rv0, Rv2);
+    Op1(Rv3, Rv2);
 
 
     // TIMED.
@@ -70,8 +956,23 @@ int main(int argc, char** argv) {
     // Start.
     const auto T2 = high_resolution_clock::now();
 
-    // sGMRES.
-    const auto [R0, R1] = internal::sGMRES_RvNNvNvRvRvNN_RR(Rv1, N0, Nv0, Nv1, Rv0, Rv3, N1, N2);
+    // sGMRES, double or single precision.
+    const auto [R0, R1] = [&]() -> std::array<real_t, 2> {
+        if(!B7)
+            return sGMRES_RvNSyOpOfPwRvNN_RR(Rv1, N0, Sy0, Op0, Of0, Pw0, Rv3, N1, N2);
+
+        float* Rv19 = new float[N0]();
+        float* Rv20 = internal::Nrw_RvN_Rv<float>(Rv3, N0);
+
+        const auto [R10, R11] = sGMRES_RvNSyOpOfPwRvNN_RR(Rv19, N0, Sy0, Op2, Of1, internal::powers_t<float>{}, Rv20, N1, N2);
+
+        for(natural_t N3 = 0; N3 < N0; ++N3)
+            Rv1[N3] = Rv19[N3];
+
+        delete[] Rv19; delete[] Rv20;
+
+        return {R10, R11};
+    }();
 
     // End.
     const auto T3 = high_resolution_clock::now();
@@ -81,11 +982,31 @@ int main(int argc, char** argv) {
 
 
     // Durations.
-    auto D0 = duration_cast<milliseconds>(T1 - T0);
+    auto D0 = duration_cast<milliseconds>(D2);
     auto D1 = duration_cast<milliseconds>(T3 - T2);
 
-    // Residual.
-    internal::RMlc_RvtNNvNvRvRvRv_0(Rv4, N0, Nv0, Nv1, Rv0, Rv1, Rv3);
+    // Loading throughput.
+    const real_t R6 = D2.count();
+    const real_t R7 = static_cast<real_t>(std::filesystem::file_size(B1 ? St0 : std::string(argv[1]))) / R6 / 1.0E6;
+    const real_t R8 = static_cast<real_t>(Nv0[N0]) / R6;
+
+    // Solver's operator relative error, on the expected solution, in its precision.
+    if(B7)
+        Op_RvtOpRvNNv_0(Rv4, Op2, Rv2, N0, Sy0.Nv4);
+    else
+        Op_RvtOpRvNNv_0(Rv4, Op0, Rv2, N0, Sy0.Nv4);
+
+    for(natural_t N3 = 0; N3 < N0; ++N3)
+        Rv4[N3] -= Rv3[N3];
+
+    const real_t R9 = internal::Nr_RvN_R(Rv4, N0) / internal::Nr_RvN_R(Rv3, N0);
+
+    // Residual, full-precision operator.
+    std::fill_n(Rv4, N0, 0.0);
+    Op1(Rv4, Rv1);
+
+    for(natural_t N3 = 0; N3 < N0; ++N3)
+        Rv4[N3] = Rv3[N3] - Rv4[N3];
 
     // Relative residual.
     const real_t R2 = internal::Nr_RvN_R(Rv4, N0);
@@ -104,13 +1025,123 @@ int main(int argc, char** argv) {
     std::println("\tError: {:.3e}\n\tError, relative: {:.3e}", R4, R5);
     std::println("Estimates:\n\tResidual: {:.3e}\n\tCondition: {:.3e}", R0, R1);
     std::println("Timings:\n\tLoading: {}\n\tsGMRES: {}", D0, D1);
+
+    #ifdef RCM_ORDERING
+    std::println("\tReordering: {}", duration_cast<milliseconds>(Sy0.D0));
+    #endif
+
+    std::println("Storage:\n\tSymmetric: {}\n\tIndices: {} bits\n\tValues: {} bits", B3, 8 * sizeof(index_t), B7 ? 32 : 8 * sizeof(stored_t));
+    std::println("\tPrecision: {} bits", B7 ? 32 : 64);
+    std::println("\tOperator, relative error: {:.3e}", R9);
+
+    #ifdef RCM_ORDERING
+    std::println("\tBandwidth, RCM: {} -> {}\n\tProfile, RCM: {} -> {}", Sy0.N1, Sy0.N2, Sy0.N3, Sy0.N4);
+    #endif
+
+    // Single-precision solves report their own operator.
+    if(B7)
+        std::println("\tKernel: {}, single precision", internal::Nm_K_St(B3 ? internal::kernel_t::symmetric : internal::kernel_t::split));
+
+    Rpt_NNLyBB_0(N0, Nv0[N0], Ly0, B3, B7);
+    Rpt_MpBB_0(Mp0, B3, B7);
+
+    std::println("Cache:\n\tLoaded: {}\n\tAvailable: {}", B1, B2);
+
+    #ifndef RCM_ORDERING
+    std::println("\tCopied, pages not local: {}", Sy0.B0);
+    #endif
+
+    // Placement, threads and solver's matrix pages on each reported node, unplaced pages apart.
+    const natural_t N14 = internal::Nds_0_N();
+    const std::vector<natural_t> Nv5 = internal::Plc_CvN_Nv(Sy0.Nv1, Sy0.Nv0[N0] * sizeof(index_t));
+    const std::vector<natural_t> Nv6 = internal::Plc_CvN_Nv(Sy0.Rv0, Sy0.Nv0[N0] * sizeof(real_t));
+
+    std::println("Placement:\n\tNodes: {}\n\tThreads, pinned: {}\n\tThreads, nodes: {}", N14, B5, internal::Thr_0_Nv());
+    std::println("\tIndices, pages per node: {}, unplaced: {}", std::span(Nv5.data(), N14), Nv5[N14]);
+    std::println("\tValues, pages per node: {}, unplaced: {}", std::span(Nv6.data(), N14), Nv6[N14]);
+    std::println("Throughput:\n\tLoading: {:.3e} MB/s, {:.3e} nnz/s", R7, R8);
     std::println("---");
 
     // Clean-up.
-    delete[] Nv0; delete[] Nv1; delete[] Rv0;
+    Cly_Ly_0(Ly0);
+    Clp_Mp_0(Mp0);
+
+    Clv_Rv_0(Rv6);
+    Cls_Sy_0(Sy0);
+
+    if(B1)
+        internal::Clb_Nv_0(Nv0);
+    else {
+        delete[] Nv0; delete[] Nv1; delete[] Rv0;
+    }
+
+    delete[] Nv2; delete[] Nv3;
+
+    delete[] Rv18;
+
     delete[] Rv1;
+    delete[] Rv2;
     delete[] Rv3;
     delete[] Rv4;
 
     return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char** argv) {
+
+    // Seeding.
+    std::srand(std::time(nullptr));
+
+    // Arguments.
+    if(argc < 3) {
+        std::println("Usage: {} St [String, path] N [Natural, Subspace dimension] N? [Natural, Arnoldi] N? [Natural, Precision, 32 or 64]", argv[0]);
+        return -1;
+    }
+
+
+    // Thread pinning, before any first touch.
+    #ifdef PIN_THREADS
+    const bool B5 = internal::Pin_0_B();
+    #else
+    const bool B5 = false;
+    #endif
+
+
+    // TIMED.
+
+
+    // Binary cache, used when newer than the matrix file.
+    const std::string St0 = std::string(argv[1]) + ".nass";
+    const bool B0 = std::filesystem::exists(St0) && std::filesystem::last_write_time(St0) >= std::filesystem::last_write_time(argv[1]);
+
+    // Start.
+    const auto T0 = high_resolution_clock::now();
+
+    // Binary cache, compact or wide indices.
+    if(B0) {
+        const auto Sp0 = internal::Ldb_St_NNvNvRvB<natural32_t>(St0);
+
+        if(std::get<0>(Sp0) > 0)
+            return Test(argc, argv, Sp0, St0, true, B5, high_resolution_clock::now() - T0);
+
+        const auto Sp1 = internal::Ldb_St_NNvNvRvB<natural_t>(St0);
+
+        if(std::get<0>(Sp1) > 0)
+            return Test(argc, argv, Sp1, St0, true, B5, high_resolution_clock::now() - T0);
+    }
+
+    // Sparse matrix, compact indices whenever the header allows them.
+    const bool B3 = internal::Sym_St_B(argv[1]);
+    const auto [N0, N1] = internal::Sz_St_NN(argv[1]);
+
+    if(internal::Nrw_NN_B(N0, N1)) {
+        const auto [N2, Nv0, Nv1, Rv0] = B3 ? internal::Sps_St_NNvNvRv<natural32_t>(argv[1]) : internal::Spc_St_NNvNvRv<natural32_t>(argv[1]);
+
+        return Test(argc, argv, std::tuple<natural_t, const natural32_t*, const natural32_t*, const real_t*, bool>{N2, Nv0, Nv1, Rv0, B3}, St0, false, B5, high_resolution_clock::now() - T0);
+    }
+
+    // Wide indices.
+    const auto [N2, Nv0, Nv1, Rv0] = B3 ? internal::Sps_St_NNvNvRv(argv[1]) : internal::Spc_St_NNvNvRv(argv[1]);
+
+    return Test(argc, argv, std::tuple<natural_t, const natural_t*, const natural_t*, const real_t*, bool>{N2, Nv0, Nv1, Rv0, B3}, St0, false, B5, high_resolution_clock::now() - T0);
+}